@@ -0,0 +1,140 @@
+// =========================================================
+// UTF-16  UTF-8 ũκġ (AppendUtf16AsUtf8 vs Į)
+// - Ʈ 忡  .  ؼ :
+//   g++ -O2 -std=c++17 -Isrc bench/Utf16ToUtf8Bench.cpp src/native/Utf8.cpp -o utf16bench
+//   cl /O2 /std:c++17 /EHsc /Isrc bench\Utf16ToUtf8Bench.cpp src\native\Utf8.cpp
+// - Է: ASCII ũ / ѱ  /    / 幮 surrogate pair
+// -  Į   Ȯ ( 迡 ģ pair )
+// =========================================================
+#include "native/Utf8.h"
+
+#include <chrono>
+#include <cstdio>
+#include <random>
+#include <string>
+
+namespace
+{
+    using AppendFn = void(*)(std::string&, const char16_t*, std::size_t, std::uint32_t&);
+
+    const std::size_t INPUT_UNITS = 4 * 1024 * 1024;
+    const std::size_t CHUNK_UNITS = 16 * 1024;
+    const int ROUNDS = 20;
+
+    void AppendAscii(std::u16string& s, const char* text)
+    {
+        for (; *text; ++text) s.push_back((char16_t)(unsigned char)*text);
+    }
+
+    // 0: ASCII ũ, 1: ѱ , 2: ũ + ѱ + /ȣ, 3: 2 + ̸(pair)
+    std::u16string MakeInput(int kind, std::size_t units)
+    {
+        std::mt19937 rng(1234 + kind);
+        std::u16string s;
+        s.reserve(units + 64);
+
+        while (s.size() < units)
+        {
+            if (kind == 0 || (kind >= 2 && rng() % 4 == 0))
+            {
+                AppendAscii(s, "<p class=\"hwpx-para-3\"><span class=\"c1\">");
+                if (kind == 0) AppendAscii(s, "Section 1.2 - table of contents</span></p>\n");
+                continue;
+            }
+
+            const int words = 1 + (int)(rng() % 6);
+            for (int w = 0; w < words; ++w)
+            {
+                const int len = 1 + (int)(rng() % 4);
+                for (int k = 0; k < len; ++k) s.push_back((char16_t)(0xAC00 + rng() % 11172));
+                if (kind == 3 && rng() % 16 == 0)
+                {
+                    const std::uint32_t cp = 0x1F600 + rng() % 64 - 0x10000;
+                    s.push_back((char16_t)(0xD800 + (cp >> 10)));
+                    s.push_back((char16_t)(0xDC00 + (cp & 0x3FF)));
+                }
+                s.push_back(kind >= 2 && rng() % 5 == 0 ? u',' : u' ');
+            }
+            if (kind >= 2) AppendAscii(s, "</span></p>\n");
+        }
+        return s;
+    }
+
+    void Convert(AppendFn fn, const std::u16string& in, std::size_t chunk, std::string& out)
+    {
+        out.clear();
+        std::uint32_t pendingHigh = 0;
+        for (std::size_t i = 0; i < in.size(); i += chunk)
+        {
+            const std::size_t len = in.size() - i < chunk ? in.size() - i : chunk;
+            fn(out, in.data() + i, len, pendingHigh);
+        }
+        Native::FinishWideAsUtf8(out, pendingHigh);
+    }
+
+    double BestSeconds(AppendFn fn, const std::u16string& in, std::string& out)
+    {
+        double best = 1e30;
+        for (int r = 0; r < ROUNDS; ++r)
+        {
+            const auto t0 = std::chrono::steady_clock::now();
+            Convert(fn, in, CHUNK_UNITS, out);
+            const std::chrono::duration<double> dt = std::chrono::steady_clock::now() - t0;
+            if (dt.count() < best) best = dt.count();
+        }
+        return best;
+    }
+
+    // Ȧ  ũ ߶   (pair  迡 ɸ )
+    bool CheckSame(const std::u16string& in)
+    {
+        const std::size_t chunks[] = { 1, 2, 7, 8, 9, 15, 17, 4093, CHUNK_UNITS };
+
+        std::string expect, got;
+        Convert(Native::AppendUtf16AsUtf8Scalar, in, in.size(), expect);
+        for (std::size_t chunk : chunks)
+        {
+            Convert(Native::AppendUtf16AsUtf8Scalar, in, chunk, got);
+            if (got != expect) return false;
+            Convert(Native::AppendUtf16AsUtf8, in, chunk, got);
+            if (got != expect) return false;
+        }
+        return true;
+    }
+}
+
+int main()
+{
+    const char* names[] = { "ascii-markup", "hangul", "mixed", "mixed+pairs" };
+
+    // ¦  surrogate/  high
+    std::u16string broken = MakeInput(3, 4096);
+    broken[100] = 0xDC00;
+    broken[777] = 0xD800;
+    broken.push_back(0xDBFF);
+    if (!CheckSame(broken))
+    {
+        std::printf("MISMATCH: broken surrogates\n");
+        return -1;
+    }
+
+    std::printf("%-14s %10s %10s %8s\n", "input", "scalar", "vector", "speedup");
+    for (int kind = 0; kind < 4; ++kind)
+    {
+        const std::u16string in = MakeInput(kind, INPUT_UNITS);
+        if (!CheckSame(in))
+        {
+            std::printf("MISMATCH: %s\n", names[kind]);
+            return -1;
+        }
+
+        std::string out;
+        const double scalar = BestSeconds(Native::AppendUtf16AsUtf8Scalar, in, out);
+        const double vector = BestSeconds(Native::AppendUtf16AsUtf8, in, out);
+        const double mb = (double)(in.size() * 2) / (1024.0 * 1024.0);
+
+        std::printf("%-14s %7.0f MB/s %7.0f MB/s %7.2fx\n",
+            names[kind], mb / scalar, mb / vector, scalar / vector);
+    }
+    return 0;
+}
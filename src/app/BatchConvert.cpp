@@ -0,0 +1,387 @@
+#include "app/BatchConvert.h"
+#include "app/OutputNaming.h"
+#include "app/HeadCache.h"
+#include "app/SectionCache.h"
+#include "app/ResultCache.h"
+
+#include "native/XmlReader.h"
+#include "native/WidePath.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cwctype>
+#include <deque>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <thread>
+
+namespace fs = std::filesystem;
+
+namespace
+{
+    struct BatchJob {
+        fs::path input;
+        fs::path output;
+        std::uintmax_t size = 0;
+    };
+
+    // Ŀ ť (ū  )
+    struct WorkQueue {
+        std::mutex m;
+        std::deque<size_t> jobs;
+    };
+
+    static std::wstring Trim(const std::wstring& s)
+    {
+        size_t b = 0;
+        while (b < s.size() && iswspace(s[b])) b++;
+        size_t e = s.size();
+        while (e > b && iswspace(s[e - 1])) e--;
+        return s.substr(b, e - b);
+    }
+
+    static std::wstring StripQuotes(std::wstring s)
+    {
+        s = Trim(s);
+        if (s.size() >= 2 && ((s.front() == L'"' && s.back() == L'"') || (s.front() == L'\'' && s.back() == L'\'')))
+            return s.substr(1, s.size() - 2);
+        return s;
+    }
+
+    static bool IsHwpxFile(const fs::path& p)
+    {
+        std::wstring ext = Native::FromPath(p.extension());
+        std::transform(ext.begin(), ext.end(), ext.begin(), [](wchar_t c) { return (wchar_t)towlower(c); });
+        return ext == L".hwpx";
+    }
+
+    static bool HasWildcard(const std::wstring& s)
+    {
+        return s.find_first_of(L"*?") != std::wstring::npos;
+    }
+
+    // ϸ ϵī (* ?, ҹ )
+    static bool WildcardMatch(const std::wstring& pattern, const std::wstring& name)
+    {
+        size_t p = 0, n = 0;
+        size_t starP = std::wstring::npos, starN = 0;
+
+        while (n < name.size())
+        {
+            if (p < pattern.size() && (pattern[p] == L'?' || towlower(pattern[p]) == towlower(name[n])))
+            {
+                ++p; ++n;
+            }
+            else if (p < pattern.size() && pattern[p] == L'*')
+            {
+                starP = p++;
+                starN = n;
+            }
+            else if (starP != std::wstring::npos)
+            {
+                p = starP + 1;
+                n = ++starN;
+            }
+            else
+            {
+                return false;
+            }
+        }
+
+        while (p < pattern.size() && pattern[p] == L'*') ++p;
+        return p == pattern.size();
+    }
+
+    static void ExpandInput(const std::wstring& raw, std::vector<fs::path>& files)
+    {
+        const std::wstring spec = StripQuotes(raw);
+        if (spec.empty()) return;
+
+        std::error_code ec;
+
+        // 1) ϵī:   Ҹ  (   )
+        if (HasWildcard(spec))
+        {
+            const fs::path sp = Native::ToPath(spec);
+            const std::wstring pattern = Native::FromPath(sp.filename());
+            fs::path dir = sp.parent_path();
+            if (dir.empty()) dir = L".";
+
+            for (fs::directory_iterator it(dir, ec), end; !ec && it != end; it.increment(ec))
+            {
+                if (!it->is_regular_file(ec)) continue;
+                if (WildcardMatch(pattern, Native::FromPath(it->path().filename())))
+                    files.push_back(it->path());
+            }
+            if (ec) std::wcout << L"[WARN]    ϴ: " << Native::FromPath(dir) << L"\n";
+            return;
+        }
+
+        const fs::path p = Native::ToPath(spec);
+
+        // 2) :    *.hwpx
+        if (fs::is_directory(p, ec))
+        {
+            for (fs::recursive_directory_iterator it(p, fs::directory_options::skip_permission_denied, ec), end;
+                 !ec && it != end; it.increment(ec))
+            {
+                if (it->is_regular_file(ec) && IsHwpxFile(it->path()))
+                    files.push_back(it->path());
+            }
+            if (ec) std::wcout << L"[WARN]    ߽ϴ: " << Native::FromPath(p) << L"\n";
+            return;
+        }
+
+        // 3)   (ų .hwpx ƴϸ ȯ ܰ迡 з )
+        files.push_back(p);
+    }
+
+    // Ŵ佺Ʈ: UTF-8 ؽƮ,  ٿ ϳ ( /# ּ , /ϵī )
+    static bool ReadManifest(const std::wstring& path, std::vector<fs::path>& files)
+    {
+        std::ifstream f(Native::ToPath(StripQuotes(path)), std::ios::binary);
+        if (!f.is_open()) return false;
+
+        std::string line;
+        bool first = true;
+        while (std::getline(f, line))
+        {
+            // UTF-8 BOM
+            if (first && line.size() >= 3 && (unsigned char)line[0] == 0xEF && (unsigned char)line[1] == 0xBB && (unsigned char)line[2] == 0xBF)
+                line.erase(0, 3);
+            first = false;
+
+            if (!line.empty() && line.back() == '\r') line.pop_back();
+
+            std::wstring w;
+            Native::AppendUtf8AsWide(w, line.data(), line.size());
+            w = Trim(w);
+            if (w.empty() || w[0] == L'#') continue;
+
+            ExpandInput(w, files);
+        }
+        return true;
+    }
+
+    // MakeUniquePath Ģ + ̹ ġ ̹  ̸ 
+    static fs::path ReserveUniquePath(const fs::path& desired, std::set<fs::path>& reserved)
+    {
+        fs::path out = MakeUniquePath(desired);
+
+        if (reserved.count(out))
+        {
+            const fs::path dir = desired.parent_path();
+            const std::wstring stem = Native::FromPath(desired.stem());
+            const std::wstring ext = Native::FromPath(desired.extension());
+
+            std::error_code ec;
+            for (int i = 1; i < 10000; ++i)
+            {
+                const std::wstring candidateName = stem + L" (" + std::to_wstring(i) + L")" + ext;
+                const fs::path cand = dir.empty() ? Native::ToPath(candidateName) : (dir / Native::ToPath(candidateName));
+                if (!reserved.count(cand) && !fs::exists(cand, ec))
+                {
+                    out = cand;
+                    break;
+                }
+            }
+        }
+
+        reserved.insert(out);
+        return out;
+    }
+
+    static std::wstring FormatSeconds(double sec)
+    {
+        std::wostringstream os;
+        os << std::fixed << std::setprecision(sec < 1.0 ? 3 : 2) << sec << L"s";
+        return os.str();
+    }
+
+    static std::wstring FormatBytes(std::uintmax_t bytes)
+    {
+        std::wostringstream os;
+        os << std::fixed << std::setprecision(1);
+        if (bytes >= 1024 * 1024) os << (double)bytes / (1024.0 * 1024.0) << L"MB";
+        else os << (double)bytes / 1024.0 << L"KB";
+        return os.str();
+    }
+}
+
+int RunBatchConvert(const BatchOptions& opt)
+{
+    using Clock = std::chrono::steady_clock;
+
+    // 1) Է 
+    std::vector<fs::path> files;
+    for (const auto& in : opt.inputs)
+        ExpandInput(in, files);
+
+    for (const auto& m : opt.manifests)
+    {
+        if (!ReadManifest(m, files))
+        {
+            std::wcout << L"[ERROR] Ŵ佺Ʈ   ϴ: " << m << L"\n";
+            return -1;
+        }
+    }
+
+    //     Ǹ  
+    std::sort(files.begin(), files.end());
+    files.erase(std::unique(files.begin(), files.end()), files.end());
+
+    if (files.empty())
+    {
+        std::wcout << L"[ERROR] ȯ .hwpx  ϴ.\n";
+        return -1;
+    }
+
+    const fs::path outDir = opt.outDir.empty() ? fs::path() : Native::ToPath(StripQuotes(opt.outDir));
+    std::error_code ec;
+    if (!outDir.empty() && !fs::is_directory(outDir, ec))
+    {
+        std::wcout << L"[ERROR]    ʽϴ.\n";
+        std::wcout << L"        : " << Native::FromPath(outDir) << L"\n";
+        return -1;
+    }
+
+    // 2) ۾  (ū  )
+    std::vector<BatchJob> jobs(files.size());
+    for (size_t i = 0; i < files.size(); ++i)
+    {
+        jobs[i].input = files[i];
+        jobs[i].size = fs::file_size(files[i], ec);
+        if (ec) jobs[i].size = 0;
+    }
+    std::stable_sort(jobs.begin(), jobs.end(),
+        [](const BatchJob& a, const BatchJob& b) { return a.size > b.size; });
+
+    // 3)  δ     
+    //    (Ŀ  ̸ ÿ  ʵ ġ ȿ  ̸ )
+    std::set<fs::path> reserved;
+    const std::wstring ext = OutputExtension(opt.convert.format);
+    for (auto& job : jobs)
+    {
+        fs::path desired = outDir.empty()
+            ? DefaultOutputPath(job.input, ext)
+            : outDir / DefaultOutputPath(job.input, ext).filename();
+
+        const fs::path out = ReserveUniquePath(desired, reserved);
+        job.output = out;
+    }
+
+    // 4) Ŀ Ǯ
+    unsigned int workerCount = opt.jobs ? opt.jobs : std::thread::hardware_concurrency();
+    if (workerCount == 0) workerCount = 1;
+
+    // OWPML SDK δ   Ȯε ʾ  ٷθ
+    if (!opt.convert.nativeReader && workerCount > 1)
+    {
+        std::wcout << L"[INFO] SDK  Ŀ 1 մϴ (--native   ).\n";
+        workerCount = 1;
+    }
+    workerCount = (unsigned int)std::min<size_t>(workerCount, jobs.size());
+
+    //   ̹ ̸  (ڵ)  (  )
+    ConvertOptions convertOpt = opt.convert;
+    if (workerCount > 1 && convertOpt.sectionThreads == 0)
+        convertOpt.sectionThreads = 1;
+
+    // ū Ϻ Ŀ ť     ť ū  
+    std::vector<WorkQueue> queues(workerCount);
+    for (size_t i = 0; i < jobs.size(); ++i)
+        queues[i % workerCount].jobs.push_back(i);
+
+    std::mutex logMutex;
+    WalkStats totalStats;   // logMutex ȣ
+    std::atomic<size_t> doneCount{ 0 };
+    std::atomic<size_t> okCount{ 0 };
+    std::atomic<std::uintmax_t> okBytes{ 0 };
+
+    auto takeJob = [&](unsigned int self, size_t& jobIndex) -> bool {
+        // ڱ ť ,  ٸ Ŀ ť  ū 
+        for (unsigned int k = 0; k < workerCount; ++k)
+        {
+            WorkQueue& q = queues[(self + k) % workerCount];
+            std::lock_guard<std::mutex> lock(q.m);
+            if (q.jobs.empty()) continue;
+
+            jobIndex = q.jobs.front();
+            q.jobs.pop_front();
+            return true;
+        }
+        return false;
+    };
+
+    auto worker = [&](unsigned int self) {
+        size_t jobIndex = 0;
+        while (takeJob(self, jobIndex))
+        {
+            const BatchJob& job = jobs[jobIndex];
+
+            const auto t0 = Clock::now();
+            WalkStats fileStats;
+            const bool ok = ConvertHwpxToHtml(Native::FromPath(job.input), Native::FromPath(job.output), convertOpt, opt.stats ? &fileStats : nullptr);
+            const double sec = std::chrono::duration<double>(Clock::now() - t0).count();
+
+            if (ok)
+            {
+                okCount++;
+                okBytes += job.size;
+            }
+            const size_t n = ++doneCount;
+
+            std::lock_guard<std::mutex> lock(logMutex);
+            totalStats.Add(fileStats);
+            std::wcout << (ok ? L"[OK]   " : L"[FAIL] ")
+                << n << L"/" << jobs.size() << L"  "
+                << FormatSeconds(sec) << L"  "
+                << FormatBytes(job.size) << L"  "
+                << Native::FromPath(job.input);
+            if (ok) std::wcout << L" -> " << Native::FromPath(job.output);
+            std::wcout << L"\n";
+        }
+    };
+
+    const auto start = Clock::now();
+
+    std::vector<std::thread> threads;
+    threads.reserve(workerCount);
+    for (unsigned int w = 0; w < workerCount; ++w)
+        threads.emplace_back(worker, w);
+    for (auto& t : threads)
+        t.join();
+
+    const double elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+
+    // 5) ü 
+    const size_t failed = jobs.size() - okCount.load();
+    const double safeElapsed = elapsed > 0.0 ? elapsed : 1e-9;
+
+    std::wostringstream os;
+    os << std::fixed << std::setprecision(1)
+        << L"\n[BATCH] files=" << jobs.size()
+        << L" ok=" << okCount.load()
+        << L" failed=" << failed
+        << L" workers=" << workerCount
+        << L" elapsed=" << FormatSeconds(elapsed)
+        << L" throughput=" << (double)okCount.load() / safeElapsed << L" files/s, "
+        << std::setprecision(2) << (double)okBytes.load() / (1024.0 * 1024.0) / safeElapsed << L" MB/s\n";
+    os << HeadCache::FormatStats(HeadCache::GetStats()) << L"\n";
+    if (!opt.convert.sectionCacheDir.empty())
+        os << SectionCache::FormatStats(SectionCache::GetStats()) << L"\n";
+    if (!opt.convert.resultCacheDir.empty())
+        os << ResultCache::FormatStats(ResultCache::GetStats()) << L"\n";
+    if (opt.stats)
+        os << FormatWalkStats(totalStats) << L"\n";
+    std::wcout << os.str();
+
+    return failed == 0 ? 0 : -1;
+}
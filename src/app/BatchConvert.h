@@ -0,0 +1,25 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include "app/HwpxConverter.h"
+
+// =========================================================
+// ġ ȯ ( Է  μ Ŀ Ǯ)
+// - Է:  / (   *.hwpx) / ϵī(* ?) / Ŵ佺Ʈ( ٿ ϳ)
+// - ū Ϻ ó, ڱ ť  ٸ Ŀ ť (work stealing)
+// - ϸ    +  ü ó/ ĳ Ʈ (+ --stats Ŀ  հ)
+// =========================================================
+
+struct BatchOptions {
+    std::vector<std::wstring> inputs;       // //ϵī
+    std::vector<std::wstring> manifests;    // Ŵ佺Ʈ  
+    std::wstring outDir;                    //  Է°  
+    unsigned int jobs = 0;                  // 0̸ ϵ  
+    bool stats = false;                     //  Ŀ  հ 
+    ConvertOptions convert;
+};
+
+//  ϸ 0, ϳ ϸ -1
+int RunBatchConvert(const BatchOptions& opt);
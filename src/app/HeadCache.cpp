@@ -0,0 +1,89 @@
+#include "app/HeadCache.h"
+#include "native/ContentHash.h"
+#include "native/HwpxPackage.h"
+
+#include <deque>
+#include <iomanip>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+
+namespace
+{
+    struct Entry
+    {
+        std::string xml;                            // Ʈ Ȯο 
+        std::shared_ptr<const CompiledHead> head;
+    };
+
+    struct Cache
+    {
+        std::mutex mutex;
+        std::unordered_map<std::uint64_t, Entry> byHash;
+        std::deque<std::uint64_t> order;            //   ( ͺ )
+        HeadCache::Stats stats;
+    };
+
+    static Cache& Instance()
+    {
+        static Cache cache;
+        return cache;
+    }
+}
+
+namespace HeadCache
+{
+    std::shared_ptr<const CompiledHead> Acquire(const std::string& headerXml)
+    {
+        Cache& cache = Instance();
+        const std::uint64_t hash = Native::ContentHash64(headerXml);
+
+        {
+            std::lock_guard<std::mutex> lock(cache.mutex);
+            auto it = cache.byHash.find(hash);
+            if (it != cache.byHash.end() && it->second.xml == headerXml)
+            {
+                ++cache.stats.hits;
+                return it->second.head;
+            }
+            ++cache.stats.misses;
+        }
+
+        // Ľ/  ۿ ( 带  尡 ÿ     )
+        auto compiled = std::make_shared<CompiledHead>();
+        if (!Native::ParseHead(headerXml.data(), headerXml.size(), compiled->index)) return nullptr;
+        compiled->styles.Compile(compiled->index);
+
+        std::lock_guard<std::mutex> lock(cache.mutex);
+        if (cache.byHash.find(hash) == cache.byHash.end())
+        {
+            while (cache.order.size() >= MAX_ENTRIES)
+            {
+                cache.byHash.erase(cache.order.front());
+                cache.order.pop_front();
+            }
+
+            cache.byHash.emplace(hash, Entry{ headerXml, compiled });
+            cache.order.push_back(hash);
+        }
+        return compiled;
+    }
+
+    Stats GetStats()
+    {
+        Cache& cache = Instance();
+        std::lock_guard<std::mutex> lock(cache.mutex);
+        return cache.stats;
+    }
+
+    std::wstring FormatStats(const Stats& stats)
+    {
+        const std::uint64_t total = stats.hits + stats.misses;
+        const double percent = total ? 100.0 * (double)stats.hits / (double)total : 0.0;
+
+        std::wostringstream os;
+        os << L"[HEAD CACHE] hit=" << stats.hits << L" miss=" << stats.misses
+            << L" (" << std::fixed << std::setprecision(1) << percent << L"%)";
+        return os.str();
+    }
+}
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "render/ConversionContext.h"
+
+// =========================================================
+//  ĳ (μ ü,   )
+// -   ø  header.xml Ʈ  
+//    header.xml  ؽ÷ ϵ (Ÿ/Ʈ/paraPr ε + Ÿ ±) 
+// - Ʈ ؽ +  񱳷 Ȯ (ؽ 浹̸ ̽ ó)
+// - ׸ б  shared_ptr    ȯ  带 ÿ 
+// - MAX_ENTRIES    ͺ 
+// =========================================================
+namespace HeadCache
+{
+    inline constexpr std::size_t MAX_ENTRIES = 128;
+
+    struct Stats
+    {
+        std::uint64_t hits = 0;
+        std::uint64_t misses = 0;
+    };
+
+    // header.xml   ϵ  (Ľ и nullptr)
+    std::shared_ptr<const CompiledHead> Acquire(const std::string& headerXml);
+
+    Stats GetStats();
+
+    // "[HEAD CACHE] hit=... miss=... (x%)"  
+    std::wstring FormatStats(const Stats& stats);
+}
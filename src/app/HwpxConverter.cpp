@@ -1,17 +1,37 @@
 #define DEBUG_PARA_LOG 0
 
+#include "sdk/SdkConfig.h"
+#if HWPX_USE_OWPML_SDK
 #include "sdk/OwpmSDKPrelude.h"
+#endif
 #include "app/HwpxConverter.h"
+#include "app/HeadCache.h"
+#include "app/SectionCache.h"
+#include "app/ResultCache.h"
 
 #include "render/HtmlRenderer.h"
+#include "render/ConversionContext.h"
 #include "walker/DocumentWalker.h"
+#include "walker/OutlineScan.h"
 #include "sdk/SDK_Wrapper.h"
+#include "native/HwpxPackage.h"
+#include "native/ContentHash.h"
+#include "output/OutputSink.h"
+#include "walker/WalkerConfig.h"
 
-#include <fstream>
 #include <string>
-#include <Windows.h>
 #include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
 #include <cwctype>
+#include <memory>
+#include <sstream>
+#include <iomanip>
+#include <cstdint>
+#include <functional>
 
 static std::wstring Trim(const std::wstring& s)
 {
@@ -50,96 +70,502 @@ static bool IsHwpxPath(std::wstring path)
     return EndsWithCaseInsensitive(path, L".hwpx");
 }
 
-static bool WriteUtf8File(const std::wstring& path, const std::wstring& content)
-{
-    int sizeNeeded = WideCharToMultiByte(
-        CP_UTF8, 0,
-        content.c_str(), (int)content.size(),
-        nullptr, 0,
-        nullptr, nullptr
-    );
-    if (sizeNeeded <= 0) return false;
-
-    std::string utf8(sizeNeeded, '\0');
-    WideCharToMultiByte(
-        CP_UTF8, 0,
-        content.c_str(), (int)content.size(),
-        utf8.data(), sizeNeeded,
-        nullptr, nullptr
-    );
-
-    std::ofstream f(path, std::ios::binary | std::ios::trunc);
-    if (!f.is_open()) return false;
-
-    f.write(utf8.data(), (std::streamsize)utf8.size());
-    f.close();
-    return true;
-}
-
-bool ConvertHwpxToHtml(
-    const std::wstring& inputPathRaw,
-    const std::wstring& outputPathRaw,
-    const ConvertOptions& opt
-)
+#if HWPX_USE_OWPML_SDK
+// SDK (refList)  ϵ 
+// - SDK header.xml   Ƿ HeadCache  Ź 
+static void LoadSdkHead(ConversionContext& ctx, OWPML::COwpmlDocumnet* doc)
 {
-    if (!opt.outputHtml) return false;
-
-    const std::wstring inputPath = StripQuotes(inputPathRaw);
-    const std::wstring outputPath = StripQuotes(outputPathRaw);
-
-    //  üũ(Ʈ Ʈ main ƴϾ )
-    if (!IsHwpxPath(inputPath)) return false;
-
-    OWPML::COwpmlDocumnet* doc = OWPML::COwpmlDocumnet::OpenDocument(inputPath.c_str());
-    if (!doc) return false;
-
-    // ===== Head(refList) ʱȭ =====
+    auto compiled = std::make_shared<CompiledHead>();
     auto* head = doc->GetHead();
     if (head) {
         auto* refList = head->GetrefList();
         if (refList) {
             // 1) Ÿ
             if (auto* styles = refList->Getstyles()) {
-                SDK::InitStyleMap(styles);
+                SDK::InitStyleMap(compiled->index, styles);
             }
 
             // 2) Ʈ 
             if (auto* numberings = refList->Getnumberings()) {
-                SDK::InitNumberings(numberings);
+                SDK::InitNumberings(compiled->index, numberings);
             }
 
             if (auto* bullets = refList->Getbullets()) {
-                SDK::InitBullets(bullets);
+                SDK::InitBullets(compiled->index, bullets);
             }
 
             if (auto* paraProps = refList->GetparaProperties()) {
-                SDK::InitParaProperties(paraProps);
+                SDK::InitParaProperties(compiled->index, paraProps);
             }
         }
     }
+    compiled->styles.Compile(compiled->index);
+    ctx.head = std::move(compiled);
+}
+
+// OWPML SDK   ȸ
+static bool WalkWithSdk(ConversionContext& ctx, const std::wstring& inputPath, std::string& out, const SectionDrainFn& drain)
+{
+    OWPML::COwpmlDocumnet* doc = OWPML::COwpmlDocumnet::OpenDocument(inputPath.c_str());
+    if (!doc) return false;
+
+    // ===== Head(refList) ʱȭ =====
+    LoadSdkHead(ctx, doc);
 
     // ===== ȯ  =====
-    std::wstring out;
+    bool ok = true;
     auto* sections = doc->GetSections();
     if (sections) {
         for (auto* sec : *sections) {
-            ExtractText(sec, out);
+            if (!(ok = ExtractText(ctx, sec, out, drain))) break;
         }
     }
 
-#if DEBUG_PARA_LOG
-    Html::DumpStyleLogToConsole();
-#endif
+    delete doc;
+    return ok;
+}
 
-    Html::FlushList(out);
+//  ĵ (SDK):  ü Ʈ ֻ  ܸ
+static bool ScanOutlineWithSdk(ConversionContext& ctx, const std::wstring& inputPath, std::string& out, const SectionDrainFn& drain)
+{
+    OWPML::COwpmlDocumnet* doc = OWPML::COwpmlDocumnet::OpenDocument(inputPath.c_str());
+    if (!doc) return false;
 
-    std::wstring html;
-    Html::BeginHtmlDocument(html);
-    html += out;
-    Html::EndHtmlDocument(html);
+    LoadSdkHead(ctx, doc);
 
-    const bool ok = WriteUtf8File(outputPath, html);
+    bool ok = true;
+    size_t index = 0;
+    auto* sections = doc->GetSections();
+    if (sections) {
+        for (auto* sec : *sections) {
+            ScanOutline(ctx, index++, sec, out);
+            if (out.size() >= WalkerConfig::STREAM_FLUSH_BYTES) {
+                if (!(ok = drain(out))) break;
+                out.clear();
+            }
+        }
+    }
 
     delete doc;
     return ok;
 }
+#endif
+
+// header.xml  ϵ  ( ø̸ HeadCache ״)
+// - headHash: header.xml  ؽ ( ĳ Ű)
+static bool LoadCompiledHead(ConversionContext& ctx, const Native::Package& pkg, std::uint64_t* headHash = nullptr)
+{
+    std::string xml;
+    if (!Native::ReadHeadXml(pkg, xml)) return false;
+    if (headHash) *headHash = Native::ContentHash64(xml);
+
+    auto head = HeadCache::Acquire(xml);
+    if (!head) return false;
+
+    ctx.head = std::move(head);
+    return true;
+}
+
+//  ϳ   · ʱȭ
+// -  ε   FlushList Ʈ ݰ / °   ä Ƿ
+//   " ε + / å ̾   "     ¿ 
+static void ResetSectionContext(const ConversionContext& doc, ConversionContext& sec)
+{
+    sec.html = Html::RenderState{};
+    sec.html.cellBreakPolicy = doc.html.cellBreakPolicy;
+    sec.html.cellParagraphPolicy = doc.html.cellParagraphPolicy;
+    sec.html.textMode = doc.html.textMode;
+    sec.html.textCellSeparator = doc.html.textCellSeparator;
+    sec.html.textRowSeparator = doc.html.textRowSeparator;
+    sec.prune = doc.prune;
+}
+
+// ġ  (߰ ID ڰ ִ Ҹ ǳʶٸ  ޶)
+static void AppendPruneKey(std::string& key, const ElementHandlers::PruneOptions& prune)
+{
+    key += prune.useDefaults ? 'P' : 'N';
+    for (std::uint32_t id : prune.extraIds) {
+        key += ',';
+        key += std::to_string(id);
+    }
+}
+
+//  ¿  ִ  ɼ ؽ (ResetSectionContext ̾޴ Ͱ  )
+static std::uint64_t SectionOptionsHash(const ConversionContext& ctx)
+{
+    std::string key;
+    key += ctx.html.textMode ? 'T' : 'H';
+    key += (char)ctx.html.cellBreakPolicy;
+    key += (char)ctx.html.cellParagraphPolicy;
+    key += ctx.html.textCellSeparator;
+    key += '\0';
+    key += ctx.html.textRowSeparator;
+    AppendPruneKey(key, ctx.prune);
+    return Native::ContentHash64(key);
+}
+
+using SectionRenderFn = std::function<bool(std::string& out, const SectionDrainFn& drain)>;
+
+//  ϳ: ĳÿ   ״ ̾ ̰,  render ϸ鼭   
+// -    ´   ¿ Ƿ (ResetSectionContext ) ǳʶ  ڵ ״ ̾
+static bool RenderSectionCached(const SectionCache::Scope& cache, const Native::Package& pkg, size_t index, std::string& out, const SectionDrainFn& drain, const SectionRenderFn& render)
+{
+    std::uint64_t hash = 0;
+    if (!cache.Enabled() || !Native::HashSectionXml(pkg, index, hash))
+        return render(out, drain);
+
+    std::string fragment;
+    if (SectionCache::Load(cache, hash, fragment)) {
+        out += fragment;
+        if (out.size() >= WalkerConfig::STREAM_FLUSH_BYTES) {
+            if (!drain(out)) return false;
+            out.clear();
+        }
+        return true;
+    }
+
+    //  ߿ drain  κе   (out mark   / Ӹ)
+    size_t mark = out.size();
+    auto capture = [&](const std::string& chunk) -> bool {
+        fragment.append(chunk, std::min(mark, chunk.size()), std::string::npos);
+        mark = 0;
+        return drain(chunk);
+    };
+    if (!render(out, capture)) return false;
+
+    fragment.append(out, std::min(mark, out.size()), std::string::npos);
+    SectionCache::Store(cache, hash, fragment);
+    return true;
+}
+
+//  Ǻ /·  ,  Ǻ     (İ Ʈ )
+static bool RenderSectionsParallel(ConversionContext& ctx, const Native::Package& pkg, const SectionCache::Scope& cache, unsigned int threadCount, std::string& out, const SectionDrainFn& drain)
+{
+    const size_t count = pkg.sectionEntries.size();
+
+    std::vector<std::string> parts(count);
+    std::vector<char> done(count, 0);
+    std::atomic<size_t> next{ 0 };
+    std::atomic<bool> failed{ false };
+    std::mutex doneMutex;
+    std::condition_variable doneCv;
+    std::mutex logMutex;
+
+    auto worker = [&]() {
+        ConversionContext sec;
+        sec.head = ctx.head;    // б   ( )
+
+        for (;;) {
+            const size_t i = next++;
+            if (i >= count || failed) break;
+
+            std::uint64_t hash = 0;
+            const bool cacheable = cache.Enabled() && Native::HashSectionXml(pkg, i, hash);
+
+            if (!cacheable || !SectionCache::Load(cache, hash, parts[i])) {
+                Native::SectionTree tree;
+                if (!Native::LoadSection(pkg, i, tree)) {
+                    std::lock_guard<std::mutex> lock(doneMutex);
+                    failed = true;
+                    doneCv.notify_all();
+                    break;
+                }
+
+                ResetSectionContext(ctx, sec);
+                ExtractText(sec, tree.root, parts[i]);
+                if (cacheable) SectionCache::Store(cache, hash, parts[i]);
+            }
+
+            std::lock_guard<std::mutex> lock(doneMutex);
+            done[i] = 1;
+            doneCv.notify_all();
+        }
+
+        std::lock_guard<std::mutex> lock(logMutex);
+        Html::MergeStyleLog(ctx, sec);
+        ctx.walk.Add(sec.walk);
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(threadCount);
+    for (unsigned int t = 0; t < threadCount; ++t)
+        threads.emplace_back(worker);
+
+    // ȣ :   ٷȴٰ  ѱ ٷ 
+    for (size_t i = 0; i < count; ++i) {
+        {
+            std::unique_lock<std::mutex> lock(doneMutex);
+            doneCv.wait(lock, [&] { return done[i] != 0 || failed; });
+            if (!done[i]) break;
+        }
+
+        out += parts[i];
+        std::string().swap(parts[i]);
+
+        if (out.size() >= WalkerConfig::STREAM_FLUSH_BYTES) {
+            if (!drain(out)) { failed = true; break; }
+            out.clear();
+        }
+    }
+
+    for (auto& t : threads)
+        t.join();
+
+    return !failed;
+}
+
+// Ƽ : zip header.xml / sectionN.xml   (SDK ʿ)
+static bool WalkWithNativeReader(ConversionContext& ctx, const std::wstring& inputPath, SectionCache::Scope cache, std::string& out, unsigned int sectionThreads, const SectionDrainFn& drain)
+{
+    Native::Package pkg;
+    if (!Native::OpenPackage(inputPath, pkg)) return false;
+
+    // ===== Head(refList) ʱȭ =====
+    if (!LoadCompiledHead(ctx, pkg, &cache.headHash)) return false;
+
+    // ===== ȯ  =====
+    if (sectionThreads == 0) sectionThreads = std::thread::hardware_concurrency();
+    sectionThreads = (unsigned int)std::min<size_t>(sectionThreads, pkg.sectionEntries.size());
+
+    if (sectionThreads > 1)
+        return RenderSectionsParallel(ctx, pkg, cache, sectionThreads, out, drain);
+
+    // :  Ʈ ϳ  ٷ 
+    for (size_t i = 0; i < pkg.sectionEntries.size(); ++i) {
+        auto render = [&](std::string& buf, const SectionDrainFn& sectionDrain) {
+            Native::SectionTree tree;
+            return Native::LoadSection(pkg, i, tree) && ExtractText(ctx, tree.root, buf, sectionDrain);
+        };
+        if (!RenderSectionCached(cache, pkg, i, out, drain, render)) return false;
+    }
+
+    return true;
+}
+
+// Ʈ:  XML ̺Ʈ ٷ ϸ鼭 ݾ 
+// -  ü HTML ޸𸮿   ( XML  +  ū ǥ ϳ з)
+static bool WalkStreaming(ConversionContext& ctx, const std::wstring& inputPath, SectionCache::Scope cache, std::string& out, const SectionDrainFn& drain)
+{
+    Native::Package pkg;
+    if (!Native::OpenPackage(inputPath, pkg)) return false;
+
+    // ===== Head(refList) ʱȭ =====
+    if (!LoadCompiledHead(ctx, pkg, &cache.headHash)) return false;
+
+    // ===== ȯ  ===== ( XML ϳ а ٷ )
+    for (size_t i = 0; i < pkg.sectionEntries.size(); ++i) {
+        auto render = [&](std::string& buf, const SectionDrainFn& sectionDrain) {
+            std::string xml;
+            return Native::ReadSectionXml(pkg, i, xml) && StreamSectionXml(ctx, xml.data(), xml.size(), buf, sectionDrain);
+        };
+        if (!RenderSectionCached(cache, pkg, i, out, drain, render)) return false;
+    }
+    return true;
+}
+
+//  ĵ (Ƽ):  XML    
+static bool ScanOutlineNative(ConversionContext& ctx, const std::wstring& inputPath, std::string& out, const SectionDrainFn& drain)
+{
+    Native::Package pkg;
+    if (!Native::OpenPackage(inputPath, pkg)) return false;
+
+    if (!LoadCompiledHead(ctx, pkg)) return false;
+
+    std::string xml;
+    for (size_t i = 0; i < pkg.sectionEntries.size(); ++i) {
+        if (!Native::ReadSectionXml(pkg, i, xml)) return false;
+        if (!ScanOutlineXml(ctx, i, xml.data(), xml.size(), out)) return false;
+
+        if (out.size() >= WalkerConfig::STREAM_FLUSH_BYTES) {
+            if (!drain(out)) return false;
+            out.clear();
+        }
+    }
+    return true;
+}
+
+bool ConvertHwpxToSink(
+    const std::wstring& inputPathRaw,
+    Output::Sink& sink,
+    const ConvertOptions& opt,
+    WalkStats* stats
+)
+{
+    const std::wstring inputPath = StripQuotes(inputPathRaw);
+
+    //  üũ(Ʈ Ʈ main ƴϾ )
+    if (!IsHwpxPath(inputPath)) return false;
+
+    // ȯ 1  (    忡 ÿ ȣ )
+    ConversionContext ctx;
+    ctx.prune = opt.prune;
+
+    //  (out) /  sink  ۷ Ѿ
+    // -  Ӹ ù    Բ  (Ű    ƹ͵  )
+    auto drain = [&](const std::string& chunk) -> bool {
+        return sink.Write(chunk);
+    };
+
+    std::string out;
+
+    //  ĵ:  / Ӹ   ٸ
+    if (opt.format == OutputFormat::Outline) {
+#if HWPX_USE_OWPML_SDK
+        const bool scanned = opt.nativeReader
+            ? ScanOutlineNative(ctx, inputPath, out, drain)
+            : ScanOutlineWithSdk(ctx, inputPath, out, drain);
+#else
+        const bool scanned = ScanOutlineNative(ctx, inputPath, out, drain);
+#endif
+        return scanned && drain(out) && sink.Flush();
+    }
+
+    const bool textMode = (opt.format != OutputFormat::Html);
+    const bool chunkMode = (opt.format == OutputFormat::Jsonl);
+    if (textMode) {
+        Html::SetTextMode(ctx, true);
+        Html::SetTextSeparators(ctx, opt.text.cellSeparator, opt.text.rowSeparator);
+        Html::SetCellBreakMode(ctx, opt.text.cellBreak);
+        Html::SetCellParagraphMode(ctx, opt.text.cellParagraph);
+    }
+    if (chunkMode) {
+        Html::SetChunkMode(ctx, opt.text.chunkBytes);
+    }
+
+    if (!textMode) Html::BeginHtmlDocument(out);
+
+    //  Ʈ  ̺Ʈ ٷ (    ʾ)
+    // -  Ʈ ȸ Ʈ ,  Ʈ(/ڽ 迭) Ҵ ° 
+    // - JSONL ûũ/ ΰ  踦 Ƿ    ׻ 
+    const bool streaming = opt.streaming
+        || (textMode && opt.nativeReader && (chunkMode || opt.sectionThreads <= 1));
+
+    //  ĳ: JSONL ûũ °  Ѿ ̾Ƿ 
+    SectionCache::Scope cache;
+    if (!chunkMode) {
+        cache.dir = opt.sectionCacheDir;
+        cache.optionsHash = SectionOptionsHash(ctx);
+    }
+
+    bool walked = false;
+    if (streaming) {
+        walked = WalkStreaming(ctx, inputPath, cache, out, drain);
+    }
+    else {
+#if HWPX_USE_OWPML_SDK
+        walked = opt.nativeReader
+            ? WalkWithNativeReader(ctx, inputPath, cache, out, opt.sectionThreads, drain)
+            : WalkWithSdk(ctx, inputPath, out, drain);
+#else
+        walked = WalkWithNativeReader(ctx, inputPath, cache, out, opt.sectionThreads, drain);
+#endif
+    }
+    if (!walked) return false;
+
+#if DEBUG_PARA_LOG
+    Html::DumpStyleLogToConsole(ctx);
+#endif
+
+    Html::FlushList(ctx, out);
+    Html::FinishChunks(ctx, out);
+    if (!textMode) Html::EndHtmlDocument(out);
+
+    if (stats) stats->Add(ctx.walk);
+
+    return drain(out) && sink.Flush();
+}
+
+//    ִ ɼ ؽ
+// - Ʈ/    ȿ  Ʈ  Ƿ 
+// - SDK  (SDK/Ƽ) :    ٴ  
+static std::uint64_t ResultOptionsHash(const ConvertOptions& opt)
+{
+    std::string key = std::to_string(CONVERTER_VERSION);
+    key += '/';
+    key += std::to_string((int)opt.format);
+#if HWPX_USE_OWPML_SDK
+    key += opt.nativeReader ? "/native" : "/sdk";
+#endif
+
+    if (opt.format == OutputFormat::Text || opt.format == OutputFormat::Jsonl) {
+        key += '\0';
+        key += opt.text.cellSeparator;
+        key += '\0';
+        key += opt.text.rowSeparator;
+        key += '\0';
+        key += (char)opt.text.cellBreak;
+        key += (char)opt.text.cellParagraph;
+    }
+    if (opt.format == OutputFormat::Jsonl) {
+        key += '/';
+        key += std::to_string(opt.text.chunkBytes);
+    }
+    if (opt.format != OutputFormat::Outline) {
+        key += '/';
+        AppendPruneKey(key, opt.prune);
+    }
+    return Native::ContentHash64(key);
+}
+
+bool ConvertHwpxToHtml(
+    const std::wstring& inputPathRaw,
+    const std::wstring& outputPathRaw,
+    const ConvertOptions& opt,
+    WalkStats* stats
+)
+{
+    const std::wstring inputPath = StripQuotes(inputPathRaw);
+    const std::wstring outputPath = StripQuotes(outputPathRaw);
+
+    // Է HWPX ƴϸ  ϵ  
+    if (!IsHwpxPath(inputPath)) return false;
+
+    //  ĳ: Է Ʈ ɼ    縸 (Ű/SDK   )
+    ResultCache::Slot cached(opt.resultCacheDir, inputPath, ResultOptionsHash(opt));
+    if (cached.Hit()) {
+        if (cached.CopyTo(outputPath)) return true;
+
+        // ǥ /fd Ϻΰ ̹   ڿ ٽ ȯ    
+        // (  CopyTo    Ƿ  ȯ)
+        if (cached.OutputStarted()) return false;
+    }
+
+    // "-"  ǥ , "fd:N"  fd,    
+    std::unique_ptr<Output::Sink> sink = Output::OpenSink(outputPath);
+    if (!sink) return false;
+
+    //  ȯ   
+    WalkStats walk;
+    if (ConvertHwpxToSink(inputPath, *sink, opt, &walk) && sink->Finish())
+    {
+        if (stats) stats->Add(walk);
+        cached.Store(outputPath);
+        return true;
+    }
+
+    //     
+    sink->Abort();
+    return false;
+}
+
+const wchar_t* OutputExtension(OutputFormat format)
+{
+    switch (format) {
+    case OutputFormat::Text: return L".txt";
+    case OutputFormat::Jsonl: return L".jsonl";
+    case OutputFormat::Outline: return L".tsv";
+    default: return L".html";
+    }
+}
+
+std::wstring FormatWalkStats(const WalkStats& stats)
+{
+    const std::uint64_t total = stats.visitedNodes + stats.prunedNodes;
+    const double percent = total ? 100.0 * (double)stats.prunedNodes / (double)total : 0.0;
+
+    std::wostringstream os;
+    os << L"[STATS] visited=" << stats.visitedNodes
+        << L" pruned=" << stats.prunedSubtrees << L" subtrees (" << stats.prunedNodes << L" nodes, "
+        << std::fixed << std::setprecision(1) << percent << L"%)";
+    return os.str();
+}
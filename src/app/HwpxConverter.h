@@ -1,12 +1,91 @@
 #pragma once
+#include <cstdint>
 #include <string>
 
+#include "sdk/SdkConfig.h"
+#include "render/HtmlRenderer.h"
+#include "walker/ElementHandlers.h"
+#include "walker/WalkStats.h"
+
+namespace Output {
+    class Sink;
+}
+
+//   ٲ  ϸ ø  (/ ĳ  ׸  ̽ )
+inline constexpr std::uint32_t CONVERTER_VERSION = 1;
+
+enum class OutputFormat {
+    Html,
+    Text,       //  (RAG ): ±/Ÿ/Ʈ , ǥ ڷ ħ
+    Jsonl,      //   /ũ   ûũ ( ٿ JSON ϳ)
+    Outline     // (): /// TSV (/ǥ  )
+};
+
+//  ¿ ǥ  ġ
+struct TextOptions {
+    std::string cellSeparator = "\t";      //     ( ĭ ڸ )
+    std::string rowSeparator = "\n";       //  
+    Html::CellBreakMode cellBreak = Html::CellBreakMode::Space;        //   ٹٲ
+    Html::CellBreakMode cellParagraph = Html::CellBreakMode::Space;    //    
+    std::size_t chunkBytes = Html::ChunkState::DEFAULT_BUDGET;         // JSONL ûũ  
+};
+
 struct ConvertOptions {
-    bool outputHtml = true; //  true ص 
+    OutputFormat format = OutputFormat::Html;
+    TextOptions text;       // format == Text / Jsonl 
+
+    // OWPML SDK  Ƽ (src/native) б
+    // - SDK  ϸ(HWPX_USE_OWPML_SDK=0) ׻ Ƽ
+    bool nativeReader = (HWPX_USE_OWPML_SDK == 0);
+
+    // Ʈ ȯ (Ƽ  )
+    // -  DOM/ü HTML  ʰ  ̺Ʈ ٷ  
+    // - 뷮 (   ) ޸ :  ū ǥ ϳ з
+    bool streaming = false;
+
+    //      (Ƽ , Ʈ ƴ )
+    // - 0: ϵ  , 1: 
+    // -  İ Ʈ  
+    // - (OutputFormat::Text) 2 ̻  , ƴϸ Ʈ η 
+    // - JSONL  ΰ  Ѿ ̾Ƿ ׻  (Ʈ )
+    unsigned int sectionThreads = 0;
+
+    //   ĳ  (Ƽ ,  )
+    // -  XML Ʈ    ũ ״ ̾  (app/SectionCache.h)
+    // - JSONL/ ĵ, SDK   
+    std::wstring sectionCacheDir;
+
+    // Ŀ ġ (  ̾ƿ Ҹ Ʈ° ǳʶ)
+    // - ⺻  Ʈ PRUNE_IDS (walker/WalkerTree.h), --no-prune  --prune-id ߰
+    // -  ĵ ü   (walker/OutlineScan.cpp)
+    ElementHandlers::PruneOptions prune;
+
+    //   ĳ  ( )
+    // - Է  Ʈ +  ɼ    縸  (app/ResultCache.h)
+    // - ġ   Է   ȯϰ  
+    std::wstring resultCacheDir;
 };
 
+//  ĺ Ȯ (".html" / ".txt" / ".jsonl" / ".tsv")
+const wchar_t* OutputExtension(OutputFormat format);
+
+// outputPath "-" ̸ ǥ , "fd:N"̸ ̹   ũ N 
+// -   ũ ۸  /  ٷ  (ӽ  )
+// - stats  Ŀ (湮/ġ  )  
 bool ConvertHwpxToHtml(
     const std::wstring& inputPath,
     const std::wstring& outputPath,
-    const ConvertOptions& opt = {}
+    const ConvertOptions& opt = {},
+    WalkStats* stats = nullptr
 );
+
+// ̹  sink  (/fd ).  Flush ϰ, Finish/Abort ȣ 
+bool ConvertHwpxToSink(
+    const std::wstring& inputPath,
+    Output::Sink& sink,
+    const ConvertOptions& opt = {},
+    WalkStats* stats = nullptr
+);
+
+// "[STATS] visited=... pruned=... (... nodes)"  
+std::wstring FormatWalkStats(const WalkStats& stats);
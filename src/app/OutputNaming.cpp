@@ -0,0 +1,124 @@
+#include "app/OutputNaming.h"
+#include "native/WidePath.h"
+
+#include <algorithm>
+#include <cwctype>
+
+namespace fs = std::filesystem;
+
+static std::wstring Trim(const std::wstring& s)
+{
+    size_t b = 0;
+    while (b < s.size() && iswspace(s[b])) b++;
+    size_t e = s.size();
+    while (e > b && iswspace(s[e - 1])) e--;
+    return s.substr(b, e - b);
+}
+
+static bool EndsWithIgnoreCase(const std::wstring& s, const std::wstring& suffix)
+{
+    if (s.size() < suffix.size()) return false;
+    size_t off = s.size() - suffix.size();
+    for (size_t i = 0; i < suffix.size(); ++i) {
+        wchar_t a = towlower(s[off + i]);
+        wchar_t b = towlower(suffix[i]);
+        if (a != b) return false;
+    }
+    return true;
+}
+
+// Windows ϸ   ( "ϸ" )
+std::wstring SanitizeFileName(std::wstring name)
+{
+    //  : < > : " / \ | ? *  + (0~31)
+    for (auto& ch : name)
+    {
+        if (ch < 32) { ch = L'_'; continue; }
+        switch (ch)
+        {
+        case L'<': case L'>': case L':': case L'"':
+        case L'/': case L'\\': case L'|': case L'?': case L'*':
+            ch = L'_';
+            break;
+        default:
+            break;
+        }
+    }
+
+    //  /  (Windows Ģ)
+    while (!name.empty() && (name.back() == L' ' || name.back() == L'.'))
+        name.pop_back();
+
+    name = Trim(name);
+    if (name.empty()) name = L"output";
+
+    //  ġ(CON, PRN, AUX, NUL, COM1~9, LPT1~9) 
+    auto upper = name;
+    std::transform(upper.begin(), upper.end(), upper.begin(), [](wchar_t c) { return (wchar_t)towupper(c); });
+
+    auto IsReserved = [&](const std::wstring& u) -> bool {
+        if (u == L"CON" || u == L"PRN" || u == L"AUX" || u == L"NUL") return true;
+        if (u.rfind(L"COM", 0) == 0 && u.size() == 4 && (u[3] >= L'1' && u[3] <= L'9')) return true;
+        if (u.rfind(L"LPT", 0) == 0 && u.size() == 4 && (u[3] >= L'1' && u[3] <= L'9')) return true;
+        return false;
+        };
+
+    if (IsReserved(upper))
+        name = L"_" + name;
+
+    return name;
+}
+
+fs::path MakeUniquePath(const fs::path& desired)
+{
+    if (!fs::exists(desired)) return desired;
+
+    fs::path dir = desired.parent_path();
+    std::wstring stem = Native::FromPath(desired.stem());
+    std::wstring ext = Native::FromPath(desired.extension());
+    if (ext.empty()) ext = L".html";
+
+    for (int i = 1; i < 10000; ++i)
+    {
+        std::wstring candidateName = stem + L" (" + std::to_wstring(i) + L")" + ext;
+        fs::path cand = dir.empty() ? Native::ToPath(candidateName) : (dir / Native::ToPath(candidateName));
+        if (!fs::exists(cand)) return cand;
+    }
+    //   ġ  fallback
+    return desired;
+}
+
+//  ο "ϸ" ϰ, Ȯ(ext, ⺻ .html) 
+fs::path NormalizeOutputPath(const fs::path& outRaw, const std::wstring& wantExt)
+{
+    fs::path dir = outRaw.parent_path();
+    std::wstring filename = Native::FromPath(outRaw.filename());
+
+    if (filename.empty()) filename = L"output" + wantExt;
+
+    // Ȯ ó
+    fs::path tmp = Native::ToPath(filename);
+    std::wstring stem = Native::FromPath(tmp.stem());
+    std::wstring ext = Native::FromPath(tmp.extension());
+
+    if (!EndsWithIgnoreCase(ext, wantExt)) {
+        // ڰ .htm / ٸ Ȯ / Ȯ  ->   Ȯڷ 
+        ext = wantExt;
+    }
+
+    stem = SanitizeFileName(stem);
+    fs::path finalName = Native::ToPath(stem + ext);
+
+    if (dir.empty()) return finalName;
+    return dir / finalName;
+}
+
+fs::path DefaultOutputPath(const fs::path& inputPath, const std::wstring& ext)
+{
+    // ڵ : Է°   + <Է stem><ext>
+    fs::path dir = inputPath.parent_path();
+    std::wstring stem = Native::FromPath(inputPath.stem());
+    stem = SanitizeFileName(stem);
+
+    return dir / Native::ToPath(stem + ext);
+}
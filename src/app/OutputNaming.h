@@ -0,0 +1,21 @@
+#pragma once
+
+#include <filesystem>
+#include <string>
+
+// =========================================================
+//   Ģ ( ȯ / ġ ȯ )
+// - Է ϸ ǵ帮 ʰ " ϸ" 
+// =========================================================
+
+// Windows ϸ   ( "ϸ" )
+std::wstring SanitizeFileName(std::wstring name);
+
+//    : (1), (2)... ٿ  
+std::filesystem::path MakeUniquePath(const std::filesystem::path& desired);
+
+//  ο "ϸ" ϰ, Ȯ(ext, ⺻ .html) 
+std::filesystem::path NormalizeOutputPath(const std::filesystem::path& outRaw, const std::wstring& ext = L".html");
+
+// output  : input   <Է stem><ext>
+std::filesystem::path DefaultOutputPath(const std::filesystem::path& inputPath, const std::wstring& ext = L".html");
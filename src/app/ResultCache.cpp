@@ -0,0 +1,226 @@
+#include "app/ResultCache.h"
+#include "native/ContentHash.h"
+#include "native/MappedFile.h"
+#include "native/WidePath.h"
+#include "output/OutputSink.h"
+
+#include <atomic>
+#include <condition_variable>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <linux/fs.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+#endif
+
+namespace fs = std::filesystem;
+
+namespace
+{
+    //  ° ؽ seed (ù °  ̸ )
+    constexpr std::uint64_t SECOND_SEED = 0x9E3779B97F4A7C15ull;
+
+    struct Cache
+    {
+        std::mutex mutex;
+        std::condition_variable released;
+        std::set<std::string> busy;     //  μ ȯ  Ű
+        ResultCache::Stats stats;
+    };
+
+    static Cache& Instance()
+    {
+        static Cache cache;
+        return cache;
+    }
+
+    static void AppendHex(std::string& s, std::uint64_t v)
+    {
+        static const char HEX[] = "0123456789abcdef";
+        for (int shift = 60; shift >= 0; shift -= 4)
+            s += HEX[(v >> shift) & 0xF];
+    }
+
+    //   ý̸   (reflink),  Ǹ Ϲ 
+    // - Windows CopyFile(copy_file) ϴ (ReFS/Dev Drive) ˾Ƽ  
+    static bool CloneOrCopy(const fs::path& from, const fs::path& to)
+    {
+#if defined(__linux__) && defined(FICLONE)
+        const int in = ::open(from.c_str(), O_RDONLY | O_CLOEXEC);
+        if (in >= 0)
+        {
+            bool cloned = false;
+            const int out = ::open(to.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0666);
+            if (out >= 0)
+            {
+                cloned = (::ioctl(out, FICLONE, in) == 0);
+                cloned = (::close(out) == 0) && cloned;
+            }
+            ::close(in);
+            if (cloned) return true;
+        }
+#endif
+        std::error_code ec;
+        fs::copy_file(from, to, fs::copy_options::overwrite_existing, ec);
+        return !ec;
+    }
+
+    // ĳ   ǥ /fd (sink  ۸  ״)
+    static bool StreamTo(const fs::path& from, Output::Sink& sink)
+    {
+        std::ifstream f(from, std::ios::binary);
+        if (!f.is_open()) return false;
+
+        std::vector<char> buf(64 * 1024);
+        while (f)
+        {
+            f.read(buf.data(), (std::streamsize)buf.size());
+            const std::size_t n = (std::size_t)f.gcount();
+            if (n > 0 && !sink.Write(buf.data(), n)) return false;
+        }
+        return f.eof() && sink.Flush();
+    }
+}
+
+namespace ResultCache
+{
+    Slot::Slot(const std::wstring& dir, const std::wstring& inputPath, std::uint64_t optionsHash)
+        : m_dir(dir)
+    {
+        if (dir.empty()) return;
+
+        // Է ؼ ؽø (̹ ׸  ü,   )
+        Native::MappedFile input;
+        if (!input.Open(inputPath)) return;
+
+        m_inputSize = input.Size();
+        m_name.reserve(16 * 4 + 4);
+        AppendHex(m_name, Native::ContentHash64(input.Data(), input.Size()));
+        AppendHex(m_name, Native::ContentHash64(input.Data(), input.Size(), SECOND_SEED));
+        AppendHex(m_name, m_inputSize);
+        AppendHex(m_name, optionsHash);
+        m_name += ".out";
+
+        Cache& cache = Instance();
+        const fs::path path = Native::ToPath(m_dir) / m_name;
+
+        //  Ű ٸ 尡 ȯ ̸   ٷȴٰ ٽ Ȯ
+        std::unique_lock<std::mutex> lock(cache.mutex);
+        cache.released.wait(lock, [&] { return cache.busy.count(m_name) == 0; });
+
+        std::error_code ec;
+        m_hit = fs::is_regular_file(path, ec);
+        if (!m_hit)
+        {
+            cache.busy.insert(m_name);
+            m_owner = true;
+            ++cache.stats.misses;
+        }
+    }
+
+    Slot::~Slot()
+    {
+        if (!m_owner) return;
+
+        Cache& cache = Instance();
+        {
+            std::lock_guard<std::mutex> lock(cache.mutex);
+            cache.busy.erase(m_name);
+        }
+        cache.released.notify_all();
+    }
+
+    bool Slot::CopyTo(const std::wstring& outputPath)
+    {
+        if (!m_hit) return false;
+
+        const fs::path from = Native::ToPath(m_dir) / m_name;
+
+        bool ok = false;
+        if (Output::IsStreamPath(outputPath))
+        {
+            std::unique_ptr<Output::Sink> sink = Output::OpenSink(outputPath);
+            ok = sink && StreamTo(from, *sink) && sink->Finish();
+
+            // ۿ ִ Ʈ    ġ  ߰ų ġ  
+            m_outputStarted = !ok && sink && (sink->BytesWritten() > 0 || sink->Failed());
+        }
+        else
+        {
+            const fs::path to = Native::ToPath(outputPath);
+            ok = CloneOrCopy(from, to);
+
+            //      (FileSink::Abort )
+            std::error_code ec;
+            if (!ok) fs::remove(to, ec);
+        }
+
+        std::error_code ec;
+        const std::uintmax_t copied = fs::file_size(from, ec);
+
+        Cache& cache = Instance();
+        std::lock_guard<std::mutex> lock(cache.mutex);
+        if (!ok)
+        {
+            ++cache.stats.misses;
+            return false;
+        }
+        ++cache.stats.hits;
+        cache.stats.inputBytesSkipped += m_inputSize;
+        if (!ec) cache.stats.outputBytesCopied += copied;
+        return true;
+    }
+
+    void Slot::Store(const std::wstring& outputPath)
+    {
+        if (!m_owner || Output::IsStreamPath(outputPath)) return;
+
+        static std::atomic<std::uint64_t> serial{ 0 };
+
+        const fs::path path = Native::ToPath(m_dir) / m_name;
+        fs::path temp = path;
+        temp += ".tmp" + std::to_string(std::hash<std::thread::id>{}(std::this_thread::get_id()))
+            + "-" + std::to_string(serial++);
+
+        //   ϸ ̵ (ٸ μ  ־  )
+        std::error_code ec;
+        if (!CloneOrCopy(Native::ToPath(outputPath), temp))
+        {
+            fs::remove(temp, ec);
+            return;
+        }
+        fs::rename(temp, path, ec);
+        if (ec) fs::remove(temp, ec);
+    }
+
+    Stats GetStats()
+    {
+        Cache& cache = Instance();
+        std::lock_guard<std::mutex> lock(cache.mutex);
+        return cache.stats;
+    }
+
+    std::wstring FormatStats(const Stats& stats)
+    {
+        const std::uint64_t total = stats.hits + stats.misses;
+        const double percent = total ? 100.0 * (double)stats.hits / (double)total : 0.0;
+
+        std::wostringstream os;
+        os << L"[RESULT CACHE] hit=" << stats.hits << L" miss=" << stats.misses
+            << L" (" << std::fixed << std::setprecision(1) << percent << L"%)"
+            << L" skipped=" << stats.inputBytesSkipped << L" input bytes"
+            << L", copied=" << stats.outputBytesCopied << L" output bytes";
+        return os.str();
+    }
+}
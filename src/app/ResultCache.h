@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+
+// =========================================================
+//   ĳ (ũ, Է  ּ)
+// -   .hwpx ̸ ٲ ٽ ø : Է Ʈ  ȯ  
+//    Է  ؽ + ȯ ɼ   ã (ϸ reflink) ϰ
+//     Ű/SDK   
+// - Ű: Է ü XXH64  (seed ٸ) + Է ũ + ɼ ؽ(//ûũ /ġ, , ȯ )
+//     ̸ <Ű>.out,    ״ (׷  = reflink )
+// -  μ ȿ  Ű ÿ ȯ  (ġ ߺ Է   Ŀ ٷȴٰ )
+// -      (ǥ /fd Ʈ ), ӽ   rename
+// - /ũ    (  ʱȭ)
+// =========================================================
+namespace ResultCache
+{
+    struct Stats
+    {
+        std::uint64_t hits = 0;
+        std::uint64_t misses = 0;
+        std::uint64_t inputBytesSkipped = 0;    // Ʈ ȯ  Է Ʈ
+        std::uint64_t outputBytesCopied = 0;    // Ʈ   Ʈ
+    };
+
+    // ȯ 1 ĳ ڸ (Begin  Ʈ CopyTo, ̽ ȯ  Store)
+    // - ̽   Ű  ٸ 尡 ٸ (Ҹ  Ǯ)
+    class Slot
+    {
+    public:
+        // Է ؽ ڸ . Է   ĳ   (Enabled() == false)
+        Slot(const std::wstring& dir, const std::wstring& inputPath, std::uint64_t optionsHash);
+        ~Slot();
+
+        Slot(const Slot&) = delete;
+        Slot& operator=(const Slot&) = delete;
+
+        bool Enabled() const { return !m_name.empty(); }
+        bool Hit() const { return m_hit; }
+
+        // Ʈ: ĳ   outputPath ("-" ǥ , "fd:N"̸ fd N)
+        bool CopyTo(const std::wstring& outputPath);
+
+        // CopyTo   ǥ /fd ̹ Ϻθ ´ (ǵ    ٽ ȯϸ  )
+        bool OutputStarted() const { return m_outputStarted; }
+
+        // ̽: ȯ    ĳÿ  (ص ȯ   )
+        void Store(const std::wstring& outputPath);
+
+    private:
+        std::wstring m_dir;
+        std::string m_name;         // ĳ  ̸ ( ĳ  )
+        std::uint64_t m_inputSize = 0;
+        bool m_hit = false;
+        bool m_owner = false;       //  Ű ȯ ̶ ǥߴ
+        bool m_outputStarted = false;
+    };
+
+    Stats GetStats();
+
+    // "[RESULT CACHE] hit=... miss=... (x%) skipped=... input bytes, copied=... output bytes"  
+    std::wstring FormatStats(const Stats& stats);
+}
@@ -0,0 +1,200 @@
+#include "app/SectionCache.h"
+#include "app/HwpxConverter.h"
+#include "native/ContentHash.h"
+#include "native/WidePath.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <sstream>
+#include <thread>
+
+namespace
+{
+    constexpr char MAGIC[4] = { 'H', 'X', 'S', 'C' };
+
+    // (4) + //ɼ ؽ(8x3)
+    constexpr std::size_t KEY_SIZE = 4 + 8 * 3;
+
+    // MAGIC + Ű +  ũ(8) +  ؽ(8)
+    constexpr std::size_t FILE_HEADER_SIZE = 4 + KEY_SIZE + 8 + 8;
+
+    struct Counters
+    {
+        std::atomic<std::uint64_t> hits{ 0 };
+        std::atomic<std::uint64_t> misses{ 0 };
+        std::atomic<std::uint64_t> bytesReused{ 0 };
+    };
+
+    static Counters& Instance()
+    {
+        static Counters counters;
+        return counters;
+    }
+
+    static void PutU32(unsigned char* p, std::uint32_t v)
+    {
+        for (int i = 0; i < 4; ++i) p[i] = (unsigned char)(v >> (8 * i));
+    }
+
+    static void PutU64(unsigned char* p, std::uint64_t v)
+    {
+        for (int i = 0; i < 8; ++i) p[i] = (unsigned char)(v >> (8 * i));
+    }
+
+    static std::uint64_t GetU64(const unsigned char* p)
+    {
+        std::uint64_t v = 0;
+        for (int i = 7; i >= 0; --i) v = (v << 8) | p[i];
+        return v;
+    }
+
+    // Ű κ ( + ؽ 3)   ̸ Ӹ  
+    static void PutKey(unsigned char* p, const SectionCache::Scope& scope, std::uint64_t sectionHash)
+    {
+        PutU32(p, CONVERTER_VERSION);
+        PutU64(p + 4, scope.headHash);
+        PutU64(p + 12, sectionHash);
+        PutU64(p + 20, scope.optionsHash);
+    }
+
+    static std::string HexU64(std::uint64_t v)
+    {
+        static const char HEX[] = "0123456789abcdef";
+
+        std::string s(16, '0');
+        for (int i = 15; i >= 0; --i, v >>= 4)
+            s[(std::size_t)i] = HEX[v & 0xF];
+        return s;
+    }
+
+    static std::filesystem::path FragmentPath(const SectionCache::Scope& scope, std::uint64_t sectionHash)
+    {
+        unsigned char key[KEY_SIZE];
+        PutKey(key, scope, sectionHash);
+        return Native::ToPath(scope.dir) / (HexU64(Native::ContentHash64(key, sizeof(key))) + ".frag");
+    }
+
+    //   ÿ  Ŀ/μ ġ ʴ ӽ ̸
+    static std::string TempSuffix()
+    {
+        static std::atomic<std::uint64_t> counter{ 0 };
+
+        const std::uint64_t parts[3] = {
+            (std::uint64_t)std::hash<std::thread::id>{}(std::this_thread::get_id()),
+            counter++,
+            (std::uint64_t)std::chrono::steady_clock::now().time_since_epoch().count()
+        };
+        return ".tmp" + HexU64(Native::ContentHash64(parts, sizeof(parts)));
+    }
+}
+
+namespace SectionCache
+{
+    bool Load(const Scope& scope, std::uint64_t sectionHash, std::string& fragment)
+    {
+        Counters& counters = Instance();
+        fragment.clear();
+
+        const std::filesystem::path path = FragmentPath(scope, sectionHash);
+        std::ifstream f(path, std::ios::binary);
+
+        unsigned char head[FILE_HEADER_SIZE];
+        unsigned char key[KEY_SIZE];
+        PutKey(key, scope, sectionHash);
+
+        bool ok = f.is_open()
+            && f.read((char*)head, sizeof(head))
+            && std::equal(MAGIC, MAGIC + 4, (const char*)head)
+            && std::equal(key, key + KEY_SIZE, head + 4);
+
+        if (ok)
+        {
+            const std::uint64_t size = GetU64(head + 4 + KEY_SIZE);
+            const std::uint64_t hash = GetU64(head + 4 + KEY_SIZE + 8);
+
+            // ũ ʵ   ̿    (  ū Ҵ  )
+            std::error_code ec;
+            const std::uintmax_t fileSize = std::filesystem::file_size(path, ec);
+            ok = !ec && fileSize >= FILE_HEADER_SIZE && size == fileSize - FILE_HEADER_SIZE
+                && size <= (std::uint64_t)fragment.max_size();
+
+            if (ok) fragment.resize((std::size_t)size);
+            ok = ok && (size == 0 || f.read(&fragment[0], (std::streamsize)size))
+                && f.peek() == std::char_traits<char>::eof()
+                && Native::ContentHash64(fragment) == hash;
+        }
+
+        if (!ok)
+        {
+            fragment.clear();
+            ++counters.misses;
+            return false;
+        }
+
+        ++counters.hits;
+        counters.bytesReused += fragment.size();
+        return true;
+    }
+
+    void Store(const Scope& scope, std::uint64_t sectionHash, const std::string& fragment)
+    {
+        const std::filesystem::path path = FragmentPath(scope, sectionHash);
+        std::filesystem::path temp = path;
+        temp += TempSuffix();
+
+        unsigned char head[FILE_HEADER_SIZE];
+        std::copy(MAGIC, MAGIC + 4, head);
+        PutKey(head + 4, scope, sectionHash);
+        PutU64(head + 4 + KEY_SIZE, fragment.size());
+        PutU64(head + 4 + KEY_SIZE + 8, Native::ContentHash64(fragment));
+
+        {
+            std::ofstream f(temp, std::ios::binary | std::ios::trunc);
+            if (!f.is_open()) return;
+
+            f.write((const char*)head, sizeof(head));
+            f.write(fragment.data(), (std::streamsize)fragment.size());
+            f.close();
+
+            if (!f)
+            {
+                std::error_code ec;
+                std::filesystem::remove(temp, ec);
+                return;
+            }
+        }
+
+        //   ϸ ̵ (̹   ̹Ƿ ᵵ )
+        std::error_code ec;
+        std::filesystem::rename(temp, path, ec);
+        if (ec) std::filesystem::remove(temp, ec);
+    }
+
+    Stats GetStats()
+    {
+        Counters& counters = Instance();
+
+        Stats stats;
+        stats.hits = counters.hits.load();
+        stats.misses = counters.misses.load();
+        stats.bytesReused = counters.bytesReused.load();
+        return stats;
+    }
+
+    std::wstring FormatStats(const Stats& stats)
+    {
+        const std::uint64_t total = stats.hits + stats.misses;
+        const double percent = total ? 100.0 * (double)stats.hits / (double)total : 0.0;
+
+        std::wostringstream os;
+        os << L"[SECTION CACHE] hit=" << stats.hits << L" miss=" << stats.misses
+            << L" (" << std::fixed << std::setprecision(1) << percent << L"%)"
+            << L" reused=" << stats.bytesReused << L" bytes";
+        return os.str();
+    }
+}
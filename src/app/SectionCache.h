@@ -0,0 +1,50 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// =========================================================
+//   ĳ (ũ, μ/  )
+// -  Ÿ͸ ٲ 纯ȯ: sectionN.xml Ʈ ״
+//    Ǻ  ()  ΰ  ȯ ȸ  ̾ 
+// - Ű: (ȯ  CONVERTER_VERSION, header.xml ؽ,  ׸ ؽ,  ɼ ؽ)
+//    ؽô zip   Ʈ + CRC-32/ũ  Ʈ    
+//   (  ٸ  ٽ   ̽   )
+// -    +  + ɼǸ  (    )
+//    JSONL(ûũ/ ΰ  )  
+// -  ϳ =  ϳ: <dir>/<Ű 16>.frag
+//   Ӹ Ű ü +  ؽø ,    ¾ƾ Ʈ (  ̽)
+//    ӽ   rename ( μ/ġ Ŀ   ᵵ )
+// - /ũ    (  ʱȭ)
+// =========================================================
+namespace SectionCache
+{
+    //  ϳ ȯ  (/ɼ  ȿ )
+    struct Scope
+    {
+        std::wstring dir;               //  ĳ 
+        std::uint64_t headHash = 0;
+        std::uint64_t optionsHash = 0;
+
+        bool Enabled() const { return !dir.empty(); }
+    };
+
+    struct Stats
+    {
+        std::uint64_t hits = 0;
+        std::uint64_t misses = 0;
+        std::uint64_t bytesReused = 0;  // Ʈ ̾   Ʈ
+    };
+
+    //  б (ų Ű   false)
+    bool Load(const Scope& scope, std::uint64_t sectionHash, std::string& fragment);
+
+    //   (ص ȯ   ȯ )
+    void Store(const Scope& scope, std::uint64_t sectionHash, const std::string& fragment);
+
+    Stats GetStats();
+
+    // "[SECTION CACHE] hit=... miss=... (x%) reused=... bytes"  
+    std::wstring FormatStats(const Stats& stats);
+}
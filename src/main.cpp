@@ -2,13 +2,29 @@
 #include <iostream>
 #include <string>
 #include <cwctype>
+#include <cwchar>
 #include <algorithm>
 #include <filesystem>
+#include <vector>
 
+#ifdef _WIN32
 #include <fcntl.h>
 #include <io.h>
+#else
+#include <clocale>
+#include <cstdlib>
+#include <cstring>
+#endif
 
 #include "app/HwpxConverter.h"
+#include "app/OutputNaming.h"
+#include "app/BatchConvert.h"
+#include "app/HeadCache.h"
+#include "app/SectionCache.h"
+#include "app/ResultCache.h"
+#include "native/Utf8.h"
+#include "native/WidePath.h"
+#include "output/OutputSink.h"
 
 namespace fs = std::filesystem;
 
@@ -54,185 +70,307 @@ static bool ContainsWhitespaceOrParen(const std::wstring& s)
     return false;
 }
 
-// Windows ϸ   ( "ϸ" )
-static std::wstring SanitizeFileName(std::wstring name)
+//  ɼ : \t \n \r \\ ̽  UTF-8
+static std::string UnescapeSeparator(const std::wstring& v)
 {
-    //  : < > : " / \ | ? *  + (0~31)
-    for (auto& ch : name)
-    {
-        if (ch < 32) { ch = L'_'; continue; }
-        switch (ch)
-        {
-        case L'<': case L'>': case L':': case L'"':
-        case L'/': case L'\\': case L'|': case L'?': case L'*':
-            ch = L'_';
-            break;
-        default:
-            break;
+    std::wstring s;
+    for (size_t i = 0; i < v.size(); ++i) {
+        if (v[i] == L'\\' && i + 1 < v.size()) {
+            const wchar_t n = v[++i];
+            if (n == L't') s += L'\t';
+            else if (n == L'n') s += L'\n';
+            else if (n == L'r') s += L'\r';
+            else s += n;
+            continue;
         }
+        s += v[i];
     }
 
-    //  /  (Windows Ģ)
-    while (!name.empty() && (name.back() == L' ' || name.back() == L'.'))
-        name.pop_back();
-
-    name = Trim(name);
-    if (name.empty()) name = L"output";
-
-    //  ġ(CON, PRN, AUX, NUL, COM1~9, LPT1~9) 
-    auto upper = name;
-    std::transform(upper.begin(), upper.end(), upper.begin(), [](wchar_t c) { return (wchar_t)towupper(c); });
-
-    auto IsReserved = [&](const std::wstring& u) -> bool {
-        if (u == L"CON" || u == L"PRN" || u == L"AUX" || u == L"NUL") return true;
-        if (u.rfind(L"COM", 0) == 0 && u.size() == 4 && (u[3] >= L'1' && u[3] <= L'9')) return true;
-        if (u.rfind(L"LPT", 0) == 0 && u.size() == 4 && (u[3] >= L'1' && u[3] <= L'9')) return true;
-        return false;
-        };
-
-    if (IsReserved(upper))
-        name = L"_" + name;
-
-    return name;
-}
-
-static fs::path MakeUniquePath(const fs::path& desired)
-{
-    if (!fs::exists(desired)) return desired;
-
-    fs::path dir = desired.parent_path();
-    std::wstring stem = desired.stem().wstring();
-    std::wstring ext = desired.extension().wstring();
-    if (ext.empty()) ext = L".html";
-
-    for (int i = 1; i < 10000; ++i)
-    {
-        std::wstring candidateName = stem + L" (" + std::to_wstring(i) + L")" + ext;
-        fs::path cand = dir.empty() ? fs::path(candidateName) : (dir / candidateName);
-        if (!fs::exists(cand)) return cand;
-    }
-    //   ġ  fallback
-    return desired;
+    std::string out;
+    Native::AppendWideAsUtf8(out, s);
+    return out;
 }
 
-//  ο "ϸ" ϰ, Ȯ .html 
-static fs::path NormalizeOutputPath(const fs::path& outRaw)
+// "805306400,805306401"  prune.extraIds (10, ǥ )
+static bool ParsePruneIds(const std::wstring& v, ElementHandlers::PruneOptions& prune)
 {
-    fs::path dir = outRaw.parent_path();
-    std::wstring filename = outRaw.filename().wstring();
-
-    if (filename.empty()) filename = L"output.html";
-
-    // Ȯ ó
-    fs::path tmp(filename);
-    std::wstring stem = tmp.stem().wstring();
-    std::wstring ext = tmp.extension().wstring();
-
-    if (!EndsWithIgnoreCase(ext, L".html")) {
-        // ڰ .htm / ٸ Ȯ / Ȯ  -> .html 
-        ext = L".html";
+    size_t pos = 0;
+    while (pos <= v.size()) {
+        size_t comma = v.find(L',', pos);
+        if (comma == std::wstring::npos) comma = v.size();
+
+        const std::wstring item = Trim(v.substr(pos, comma - pos));
+        wchar_t* end = nullptr;
+        const unsigned long long id = std::wcstoull(item.c_str(), &end, 10);
+        if (item.empty() || *end != L'\0' || id == 0 || id > 0xFFFFFFFFull) return false;
+        prune.Add((std::uint32_t)id);
+
+        pos = comma + 1;
     }
-
-    stem = SanitizeFileName(stem);
-    fs::path finalName = fs::path(stem + ext);
-
-    if (dir.empty()) return finalName;
-    return dir / finalName;
+    return true;
 }
 
 static void PrintUsage(const wchar_t* argv0)
 {
     std::wcout << L":\n"
-        << L"  " << argv0 << L" <input.hwpx> [output.html]\n\n"
+        << L"  " << argv0 << L" [--native] [--stream] [--stats] [--text | --jsonl | --outline] <input.hwpx> [output.html | - | fd:N]\n"
+        << L"  " << argv0 << L" --batch [--jobs N] [--out <dir>] [--manifest <list.txt>] <Է...>\n\n"
+        << L"ɼ:\n"
+        << L"  --native : OWPML SDK  Ƽ  б (SDK   ׻ Ƽ)\n"
+        << L"  --stream :  Ʈ ȯϸ ٷ  (뷮 , Ƽ )\n"
+        << L"  --section-jobs N :      (0=ڵ, 1=, Ƽ )\n"
+        << L"  --stats  : ȯ  Ŀ   (湮 , ġ ǳʶ ,  ĳ Ʈ)\n"
+        << L"  --no-prune : ̾ƿ (lineseg 迭, ü ġ/ũ ) ġ \n"
+        << L"  --prune-id <id,...> : Ʈ° ǳʶ  ID ߰ (SDK: ĵ α ID,    )\n"
+        << L"  --section-cache <dir> :   ĳ  ( XML    , Ƽ )\n"
+        << L"  --result-cache <dir>  :   ĳ  (Է     , ġ ߺ Է )\n\n"
+        << L"/ûũ (RAG ):\n"
+        << L"  --text           : ±/Ÿ/Ʈ  ڸ .txt (ǥ / ڷ ħ)\n"
+        << L"  --cell-sep <s>   :     (⺻ \\t, \\t \\n \\\\  )\n"
+        << L"  --row-sep <s>    : ǥ   (⺻ \\n)\n"
+        << L"  --jsonl          :     ûũ .jsonl (heading , table/list ǥ)\n"
+        << L"  --chunk-bytes N  : JSONL ûũ   Ʈ (⺻ 2048, /ǥ  ڸ)\n"
+        << L"  --outline        : ()  .tsv (,  ȣ, , ; /ǥ ǳʶ)\n\n"
+        << L"ġ:\n"
+        << L"  --batch           : Է   Ŀ Ǯ ȯ (Է = //ϵī)\n"
+        << L"  --jobs N          : Ŀ  (⺻: CPU  )\n"
+        << L"  --out <dir>       :   (  Է°  )\n"
+        << L"  --manifest <file> : Է   (UTF-8,  ٿ ϳ, # ּ)\n\n"
         << L"Ģ:\n"
-        << L"  - output  : input   <Էϸ>.html ڵ \n"
+        << L"  - output  : input   <Էϸ>.html (--text .txt, --jsonl̸ .jsonl, --outline̸ .tsv) ڵ \n"
+        << L"  - output - ̸ ǥ , fd:N ̸ ̹   ũ N  (޽ stderr)\n"
         << L"  -  ϸ  ڷ (Է ϸ  )\n"
         << L"  -    : (1), (2)... ٿ  \n";
 }
 
 int wmain(int argc, wchar_t* argv[])
 {
+#ifdef _WIN32
     // ܼ wide  ȭ (ѱ/  )
     _setmode(_fileno(stdout), _O_U16TEXT);
     _setmode(_fileno(stderr), _O_U16TEXT);
+#endif
 
-    if (argc < 2) {
+    ConvertOptions opt;
+
+    bool batch = false;
+    bool stats = false;
+    BatchOptions batchOpt;
+
+    // ɼ(--xxx) ġ  и
+    std::vector<std::wstring> args;
+    for (int i = 1; i < argc; ++i) {
+        const std::wstring a = argv[i];
+        if (a.rfind(L"--", 0) == 0) {
+            if (a == L"--native") { opt.nativeReader = true; continue; }
+            if (a == L"--stream") { opt.nativeReader = true; opt.streaming = true; continue; }
+            if (a == L"--batch") { batch = true; continue; }
+            if (a == L"--stats") { stats = true; continue; }
+            if (a == L"--no-prune") { opt.prune.useDefaults = false; continue; }
+            if (a == L"--text") { opt.format = OutputFormat::Text; continue; }
+            if (a == L"--jsonl") { opt.format = OutputFormat::Jsonl; continue; }
+            if (a == L"--outline") { opt.format = OutputFormat::Outline; continue; }
+
+            //  ޴ ɼ
+            if (a == L"--jobs" || a == L"--out" || a == L"--manifest" || a == L"--section-jobs"
+                || a == L"--cell-sep" || a == L"--row-sep" || a == L"--chunk-bytes"
+                || a == L"--section-cache" || a == L"--result-cache" || a == L"--prune-id") {
+                if (i + 1 >= argc) {
+                    std::wcout << L"[ERROR] ɼ  ϴ: " << a << L"\n\n";
+                    PrintUsage(argv[0]);
+                    return -1;
+                }
+                const std::wstring v = argv[++i];
+                if (a == L"--section-jobs") {
+                    opt.sectionThreads = (unsigned int)std::wcstoul(v.c_str(), nullptr, 10);
+                    continue;
+                }
+                if (a == L"--cell-sep" || a == L"--row-sep") {
+                    std::string& sep = (a == L"--cell-sep") ? opt.text.cellSeparator : opt.text.rowSeparator;
+                    sep = UnescapeSeparator(v);
+                    continue;
+                }
+                if (a == L"--section-cache" || a == L"--result-cache") {
+                    std::wstring& dir = (a == L"--section-cache") ? opt.sectionCacheDir : opt.resultCacheDir;
+                    dir = StripQuotes(v);
+                    std::error_code ec;
+                    fs::create_directories(Native::ToPath(dir), ec);
+                    if (!fs::is_directory(Native::ToPath(dir), ec)) {
+                        std::wcout << L"[ERROR] ĳ    ϴ: " << v << L"\n";
+                        return -1;
+                    }
+                    continue;
+                }
+                if (a == L"--prune-id") {
+                    if (!ParsePruneIds(v, opt.prune)) {
+                        std::wcout << L"[ERROR] --prune-id  ùٸ ʽϴ: " << v << L"\n";
+                        return -1;
+                    }
+                    continue;
+                }
+                if (a == L"--chunk-bytes") {
+                    opt.text.chunkBytes = (size_t)std::wcstoul(v.c_str(), nullptr, 10);
+                    if (opt.text.chunkBytes == 0) {
+                        std::wcout << L"[ERROR] --chunk-bytes  ùٸ ʽϴ: " << v << L"\n";
+                        return -1;
+                    }
+                    continue;
+                }
+                if (a == L"--jobs") {
+                    batchOpt.jobs = (unsigned int)std::wcstoul(v.c_str(), nullptr, 10);
+                    if (batchOpt.jobs == 0) {
+                        std::wcout << L"[ERROR] --jobs  ùٸ ʽϴ: " << v << L"\n";
+                        return -1;
+                    }
+                }
+                else if (a == L"--out") batchOpt.outDir = v;
+                else batchOpt.manifests.push_back(v);
+                batch = true;
+                continue;
+            }
+
+            std::wcout << L"[ERROR]    ɼԴϴ: " << a << L"\n\n";
+            PrintUsage(argv[0]);
+            return -1;
+        }
+        args.push_back(a);
+    }
+
+    if (batch) {
+        batchOpt.inputs = args;
+        batchOpt.convert = opt;
+        batchOpt.stats = stats;
+        if (batchOpt.inputs.empty() && batchOpt.manifests.empty()) {
+            PrintUsage(argv[0]);
+            return -1;
+        }
+        return RunBatchConvert(batchOpt);
+    }
+
+    if (args.empty()) {
         PrintUsage(argv[0]);
         return -1;
     }
 
     //  θ ǥ  θ argv ɰ argc Ŀ
-    // ̹  ɼ Ľ  "2 Ǵ 3 " 
-    if (argc > 3) {
+    // ġ ڴ "Է []" 1 Ǵ 2 
+    if (args.size() > 2) {
         std::wcout << L"[ERROR]   ʹ ϴ. Է ο   ǥ ּ.\n";
         std::wcout << L") " << argv[0] << L" \"C:\\path with space\\in.hwpx\" out.html\n\n";
         PrintUsage(argv[0]);
         return -1;
     }
 
-    const std::wstring inputRaw = argv[1];
+    const std::wstring inputRaw = args[0];
     const std::wstring inputPathW = StripQuotes(inputRaw);
-    const fs::path inputPath(inputPathW);
+    const fs::path inputPath = Native::ToPath(inputPathW);
+
+    //  "-" / "fd:N": HTML ǥ /fd, ȳ/ ޽ stderr
+    const bool toStream = (args.size() == 2 && Output::IsStreamPath(StripQuotes(args[1])));
+    std::wostream& log = toStream ? std::wcerr : std::wcout;
 
     // 1) Ȯ ˻
     if (!IsHwpxPath(inputPathW)) {
-        std::wcout << L"[ERROR] Է  .hwpx մϴ.\n";
-        std::wcout << L"        Է: " << inputPathW << L"\n";
+        log << L"[ERROR] Է  .hwpx մϴ.\n";
+        log << L"        Է: " << inputPathW << L"\n";
         return -1;
     }
 
     // 2) Է   ˻
     std::error_code ec;
     if (!fs::exists(inputPath, ec)) {
-        std::wcout << L"[ERROR] Է  ã  ϴ.\n";
-        std::wcout << L"        Է: " << inputPathW << L"\n";
+        log << L"[ERROR] Է  ã  ϴ.\n";
+        log << L"        Է: " << inputPathW << L"\n";
         if (ContainsWhitespaceOrParen(inputPathW)) {
-            std::wcout << L"        Ʈ: ο /ȣ  ǥ μ  ּ.\n";
+            log << L"        Ʈ: ο /ȣ  ǥ μ  ּ.\n";
         }
         return -1;
     }
 
     // 3)   (ɼ)
     fs::path outputPath;
-    if (argc == 3)
+    if (toStream)
     {
-        const std::wstring outRaw = StripQuotes(argv[2]);
-        fs::path outPathRaw(outRaw);
+        // ǥ /fd: ϸ /ߺ ȸ 
+    }
+    else if (args.size() == 2)
+    {
+        const std::wstring outRaw = StripQuotes(args[1]);
+        fs::path outPathRaw = Native::ToPath(outRaw);
 
-        // ϸ sanitize + .html 
-        outputPath = NormalizeOutputPath(outPathRaw);
+        // ϸ sanitize +  Ȯ(.html/.txt) 
+        outputPath = NormalizeOutputPath(outPathRaw, OutputExtension(opt.format));
 
         //  丮  ˻(õ )
         fs::path outDir = outputPath.parent_path();
         if (!outDir.empty() && !fs::exists(outDir, ec)) {
-            std::wcout << L"[ERROR]    ʽϴ.\n";
-            std::wcout << L"        : " << outputPath.wstring() << L"\n";
+            log << L"[ERROR]    ʽϴ.\n";
+            log << L"        : " << Native::FromPath(outputPath) << L"\n";
             return -1;
         }
     }
     else
     {
-        // ڵ : Է°   + <Է stem>.html
-        fs::path dir = inputPath.parent_path();
-        std::wstring stem = inputPath.stem().wstring();
-        stem = SanitizeFileName(stem);
-
-        outputPath = dir / fs::path(stem + L".html");
+        // ڵ : Է°   + <Է stem> +  Ȯ
+        outputPath = DefaultOutputPath(inputPath, OutputExtension(opt.format));
     }
 
     // 4)  : (1)(2)...
-    outputPath = MakeUniquePath(outputPath);
-
-    ConvertOptions opt;
-    opt.outputHtml = true;
+    if (!toStream)
+        outputPath = MakeUniquePath(outputPath);
 
     // 5) ȯ
-    if (!ConvertHwpxToHtml(inputPathW, outputPath.wstring(), opt)) {
-        std::wcout << L"[ERROR] ȯ : ǥ HWPX  ƴϰų ջ   ֽϴ.\n";
-        std::wcout << L"        Է: " << inputPathW << L"\n";
+    const std::wstring outputPathW = toStream ? StripQuotes(args[1]) : Native::FromPath(outputPath);
+    WalkStats walkStats;
+    if (!ConvertHwpxToHtml(inputPathW, outputPathW, opt, stats ? &walkStats : nullptr)) {
+        log << L"[ERROR] ȯ : ǥ HWPX  ƴϰų ջ   ֽϴ.\n";
+        log << L"        Է: " << inputPathW << L"\n";
         return -1;
     }
 
-    std::wcout << L"ȯ Ϸ: " << outputPath.wstring() << L"\n";
+    if (!toStream)
+        log << L"ȯ Ϸ: " << outputPathW << L"\n";
+    if (stats) {
+        log << FormatWalkStats(walkStats) << L"\n";
+        log << HeadCache::FormatStats(HeadCache::GetStats()) << L"\n";
+        if (!opt.sectionCacheDir.empty())
+            log << SectionCache::FormatStats(SectionCache::GetStats()) << L"\n";
+        if (!opt.resultCacheDir.empty())
+            log << ResultCache::FormatStats(ResultCache::GetStats()) << L"\n";
+    }
     return 0;
 }
+
+#ifndef _WIN32
+// wmain  ȯ(Linux Ŀ ): UTF-8 argv  wide ȯ  wmain 
+static std::wstring WidenArg(const char* s)
+{
+    const size_t n = std::mbstowcs(nullptr, s, 0);
+    if (n == (size_t)-1) return std::wstring(s, s + std::strlen(s));
+
+    std::wstring w(n, L'\0');
+    std::mbstowcs(&w[0], s, n);
+    return w;
+}
+
+int main(int argc, char* argv[])
+{
+    // ѱ /޽: ȯ Ķ C UTF-8
+    std::setlocale(LC_ALL, "");
+    const char* ctype = std::setlocale(LC_CTYPE, nullptr);
+    if (!ctype || std::strcmp(ctype, "C") == 0 || std::strcmp(ctype, "POSIX") == 0)
+        std::setlocale(LC_CTYPE, "C.UTF-8");
+
+    std::vector<std::wstring> wideArgs;
+    wideArgs.reserve(argc);
+    for (int i = 0; i < argc; ++i)
+        wideArgs.push_back(WidenArg(argv[i]));
+
+    std::vector<wchar_t*> wideArgv;
+    for (auto& a : wideArgs)
+        wideArgv.push_back(&a[0]);
+    wideArgv.push_back(nullptr);
+
+    return wmain(argc, wideArgv.data());
+}
+#endif
@@ -0,0 +1,105 @@
+#include "native/ContentHash.h"
+
+namespace
+{
+    const std::uint64_t P1 = 0x9E3779B185EBCA87ull;
+    const std::uint64_t P2 = 0xC2B2AE3D27D4EB4Full;
+    const std::uint64_t P3 = 0x165667B19E3779F9ull;
+    const std::uint64_t P4 = 0x85EBCA77C2B2AE63ull;
+    const std::uint64_t P5 = 0x27D4EB2F165667C5ull;
+
+    inline std::uint64_t Rotl(std::uint64_t x, int r)
+    {
+        return (x << r) | (x >> (64 - r));
+    }
+
+    // Ʋ  б ( )
+    inline std::uint64_t Read64(const unsigned char* p)
+    {
+        std::uint64_t v = 0;
+        for (int i = 7; i >= 0; --i) v = (v << 8) | p[i];
+        return v;
+    }
+
+    inline std::uint32_t Read32(const unsigned char* p)
+    {
+        return (std::uint32_t)p[0] | ((std::uint32_t)p[1] << 8) | ((std::uint32_t)p[2] << 16) | ((std::uint32_t)p[3] << 24);
+    }
+
+    inline std::uint64_t Round(std::uint64_t acc, std::uint64_t input)
+    {
+        acc += input * P2;
+        acc = Rotl(acc, 31);
+        return acc * P1;
+    }
+
+    inline std::uint64_t MergeRound(std::uint64_t acc, std::uint64_t val)
+    {
+        acc ^= Round(0, val);
+        return acc * P1 + P4;
+    }
+}
+
+namespace Native
+{
+    std::uint64_t ContentHash64(const void* data, std::size_t size, std::uint64_t seed)
+    {
+        const unsigned char* p = (const unsigned char*)data;
+        const unsigned char* const end = p + size;
+
+        std::uint64_t h;
+        if (size >= 32)
+        {
+            std::uint64_t v1 = seed + P1 + P2;
+            std::uint64_t v2 = seed + P2;
+            std::uint64_t v3 = seed;
+            std::uint64_t v4 = seed - P1;
+
+            const unsigned char* const limit = end - 32;
+            do
+            {
+                v1 = Round(v1, Read64(p));
+                v2 = Round(v2, Read64(p + 8));
+                v3 = Round(v3, Read64(p + 16));
+                v4 = Round(v4, Read64(p + 24));
+                p += 32;
+            } while (p <= limit);
+
+            h = Rotl(v1, 1) + Rotl(v2, 7) + Rotl(v3, 12) + Rotl(v4, 18);
+            h = MergeRound(h, v1);
+            h = MergeRound(h, v2);
+            h = MergeRound(h, v3);
+            h = MergeRound(h, v4);
+        }
+        else
+        {
+            h = seed + P5;
+        }
+
+        h += (std::uint64_t)size;
+
+        for (; p + 8 <= end; p += 8)
+        {
+            h ^= Round(0, Read64(p));
+            h = Rotl(h, 27) * P1 + P4;
+        }
+        if (p + 4 <= end)
+        {
+            h ^= (std::uint64_t)Read32(p) * P1;
+            h = Rotl(h, 23) * P2 + P3;
+            p += 4;
+        }
+        for (; p < end; ++p)
+        {
+            h ^= (std::uint64_t)(*p) * P5;
+            h = Rotl(h, 11) * P1;
+        }
+
+        h ^= h >> 33;
+        h *= P2;
+        h ^= h >> 29;
+        h *= P3;
+        h ^= h >> 32;
+        return h;
+    }
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+namespace Native
+{
+    //  ؽ (XXH64, ĳ Ű)
+    // - ÷/ ϰ   (ũ ĳ Ű ᵵ )
+    // - ȣ ؽ ƴ: ĳô Ʈ  /ũ⸦ Բ Ȯ 
+    std::uint64_t ContentHash64(const void* data, std::size_t size, std::uint64_t seed = 0);
+
+    inline std::uint64_t ContentHash64(std::string_view s, std::uint64_t seed = 0)
+    {
+        return ContentHash64(s.data(), s.size(), seed);
+    }
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <vector>
+
+#include "walker/WalkerConfig.h"
+
+namespace Native
+{
+    // =========================================================
+    // Ƽ Ʈ  ID
+    // - ǥ  ID SDK (WalkerConfig)  缭 TableRenderer ״ 
+    // - /ؽƮ 迭 SDK enum(ID_PARA_*)   Ƿ ü 
+    // =========================================================
+    enum NodeId : std::uint32_t
+    {
+        NODE_UNKNOWN = 0,       // ó ʴ  (ڽĸ ȸ)
+        NODE_SECTION = 1,       // hs:sec
+        NODE_PARA = 2,          // hp:p
+        NODE_RUN = 3,           // hp:run
+        NODE_TEXT = 4,          // hp:t
+        NODE_CHAR = 5,          // hp:t  ڿ 
+        NODE_LINEBREAK = 6,     // hp:lineBreak
+        NODE_TAB = 7,           // hp:tab
+        NODE_LINESEG_ARRAY = 8, // hp:linesegarray
+        NODE_LINESEG = 9,       // hp:lineseg
+        NODE_SEC_PR = 10,       // hp:secPr (// ׵θ )
+        NODE_SHAPE_LAYOUT = 11, // ü ġ/ũ//ȯ (hp:sz, hp:pos, hp:offset, hp:renderingInfo ...)
+
+        NODE_TABLE = WalkerConfig::TABLE_ROOT_ID,           // hp:tbl
+        NODE_ROW = WalkerConfig::ROW_GROUP_ID,              // hp:tr
+        NODE_CELL = WalkerConfig::CELL_WRAPPER_ID,          // hp:tc
+        NODE_SUBLIST = WalkerConfig::CELL_CONTENT_ID,       // hp:subList
+        NODE_CELL_ADDR = WalkerConfig::CELL_ADDR_ID,        // hp:cellAddr
+        NODE_CELL_SPAN = WalkerConfig::CELL_SPAN_ID,        // hp:cellSpan
+        NODE_CELL_SZ = WalkerConfig::CELL_SZ_ID,            // hp:cellSz
+        NODE_CELL_MARGIN = WalkerConfig::CELL_MARGIN_ID,    // hp:cellMargin
+    };
+
+    struct Node
+    {
+        std::uint32_t id = NODE_UNKNOWN;
+
+        // hp:p
+        std::uint32_t styleIDRef = 0;
+        std::uint32_t paraPrIDRef = 0;
+
+        // hp:cellAddr / hp:cellSpan
+        std::uint32_t rowAddr = 0;
+        std::uint32_t colAddr = 0;
+        std::uint32_t rowSpan = 1;
+        std::uint32_t colSpan = 1;
+
+        // ڱ  Ʈ   (BuildSubtree ä, ġ )
+        std::uint32_t subtreeSize = 1;
+
+        // NODE_CHAR (ƼƼ ؼ UTF-8)
+        std::string text;
+
+        std::vector<const Node*> children;
+    };
+
+    // section ϳ з Ʈ ( )
+    struct SectionTree
+    {
+        std::deque<Node> nodes;     // push_back ص ּҰ 
+        const Node* root = nullptr;
+    };
+}
@@ -0,0 +1,336 @@
+#include "native/HwpxPackage.h"
+#include "native/XmlReader.h"
+
+#include <algorithm>
+#include <string_view>
+
+#include "sdk/SDK_Wrapper.h"
+
+namespace
+{
+    const char* const HEADER_PART = "Contents/header.xml";
+    const char* const SECTION_PREFIX = "Contents/section";
+    const char* const SECTION_SUFFIX = ".xml";
+
+    // "Contents/section12.xml"  12 ( ٸ -1)
+    static long SectionNumber(const std::string& name)
+    {
+        const std::string_view n(name);
+        const std::string_view prefix(SECTION_PREFIX);
+        const std::string_view suffix(SECTION_SUFFIX);
+
+        if (n.size() <= prefix.size() + suffix.size()) return -1;
+        if (n.substr(0, prefix.size()) != prefix) return -1;
+        if (n.substr(n.size() - suffix.size()) != suffix) return -1;
+
+        long num = 0;
+        for (std::size_t i = prefix.size(); i < n.size() - suffix.size(); ++i)
+        {
+            if (n[i] < '0' || n[i] > '9') return -1;
+            num = num * 10 + (n[i] - '0');
+        }
+        return num;
+    }
+}
+
+namespace Native
+{
+    std::uint32_t MapSectionElement(std::string_view ln)
+    {
+        switch (ln.size())
+        {
+        case 1:
+            if (ln == "p") return NODE_PARA;
+            if (ln == "t") return NODE_TEXT;
+            break;
+        case 2:
+            if (ln == "tr") return NODE_ROW;
+            if (ln == "tc") return NODE_CELL;
+            if (ln == "sz") return NODE_SHAPE_LAYOUT;
+            if (ln == "pt") return NODE_SHAPE_LAYOUT;
+            break;
+        case 3:
+            if (ln == "run") return NODE_RUN;
+            if (ln == "tab") return NODE_TAB;
+            if (ln == "tbl") return NODE_TABLE;
+            if (ln == "sec") return NODE_SECTION;
+            if (ln == "pos") return NODE_SHAPE_LAYOUT;
+            break;
+        default:
+            if (ln == "lineBreak") return NODE_LINEBREAK;
+            if (ln == "linesegarray") return NODE_LINESEG_ARRAY;
+            if (ln == "lineseg") return NODE_LINESEG;
+            if (ln == "subList") return NODE_SUBLIST;
+            if (ln == "cellAddr") return NODE_CELL_ADDR;
+            if (ln == "cellSpan") return NODE_CELL_SPAN;
+            if (ln == "cellSz") return NODE_CELL_SZ;
+            if (ln == "cellMargin") return NODE_CELL_MARGIN;
+            if (ln == "secPr") return NODE_SEC_PR;
+            if (ln == "offset" || ln == "orgSz" || ln == "curSz" || ln == "flip"
+                || ln == "outMargin" || ln == "inMargin" || ln == "rotationInfo" || ln == "renderingInfo"
+                || ln == "lineShape" || ln == "fillBrush" || ln == "shadow"
+                || ln == "imgRect" || ln == "imgClip" || ln == "imgDim")
+                return NODE_SHAPE_LAYOUT;
+            break;
+        }
+        return NODE_UNKNOWN;
+    }
+
+    void ReadNodeAttrs(const XmlReader& r, Node& n)
+    {
+        switch (n.id)
+        {
+        case NODE_PARA:
+            n.styleIDRef = r.GetAttrUInt("styleIDRef");
+            n.paraPrIDRef = r.GetAttrUInt("paraPrIDRef");
+            break;
+        case NODE_CELL_ADDR:
+            n.rowAddr = r.GetAttrUInt("rowAddr");
+            n.colAddr = r.GetAttrUInt("colAddr");
+            break;
+        case NODE_CELL_SPAN:
+            n.rowSpan = r.GetAttrUInt("rowSpan", 1);
+            n.colSpan = r.GetAttrUInt("colSpan", 1);
+            break;
+        default:
+            break;
+        }
+    }
+
+    bool OpenPackage(const std::wstring& path, Package& pkg)
+    {
+        pkg.sectionEntries.clear();
+        if (!OpenZip(path, pkg.zip)) return false;
+
+        // header.xml  HWPX ƴ
+        if (!FindZipEntry(pkg.zip, HEADER_PART)) return false;
+
+        std::vector<std::pair<long, std::size_t>> found;
+        for (std::size_t i = 0; i < pkg.zip.entries.size(); ++i)
+        {
+            const long num = SectionNumber(pkg.zip.entries[i].name);
+            if (num >= 0) found.push_back({ num, i });
+        }
+        std::sort(found.begin(), found.end());
+
+        for (const auto& f : found)
+            pkg.sectionEntries.push_back(f.second);
+
+        return true;
+    }
+
+    bool ReadHeadXml(const Package& pkg, std::string& xml)
+    {
+        const ZipEntry* entry = FindZipEntry(pkg.zip, HEADER_PART);
+        if (!entry) return false;
+
+        return ReadZipEntry(pkg.zip, *entry, xml);
+    }
+
+    bool ParseHead(const char* xml, std::size_t size, SDK::HeadIndex& head)
+    {
+        enum class Part { None, Styles, Numberings, Bullets, ParaProps };
+        Part part = Part::None;
+
+        std::vector<SDK::StyleEntry> styles;
+        std::vector<std::uint32_t> numberings;
+        std::vector<SDK::BulletEntry> bullets;
+        std::vector<SDK::ParaPrEntry> paraProps;
+
+        bool hasStyles = false, hasNumberings = false, hasBullets = false, hasParaProps = false;
+        bool bulletHeadSeen = false;
+        bool headingSeen = false;
+
+        XmlReader r(xml, size);
+        for (;;)
+        {
+            const XmlEvent ev = r.Next();
+            if (ev == XmlEvent::EndOfDocument) break;
+            if (ev == XmlEvent::Error) return false;
+
+            if (ev == XmlEvent::EndElement)
+            {
+                const std::string_view ln = r.LocalName();
+                if (ln == "styles" || ln == "numberings" || ln == "bullets" || ln == "paraProperties")
+                    part = Part::None;
+                continue;
+            }
+            if (ev != XmlEvent::StartElement) continue;
+
+            const std::string_view ln = r.LocalName();
+
+            if (ln == "styles") { part = Part::Styles; hasStyles = true; continue; }
+            if (ln == "numberings") { part = Part::Numberings; hasNumberings = true; continue; }
+            if (ln == "bullets") { part = Part::Bullets; hasBullets = true; continue; }
+            if (ln == "paraProperties") { part = Part::ParaProps; hasParaProps = true; continue; }
+
+            switch (part)
+            {
+            case Part::Styles:
+                if (ln == "style")
+                {
+                    SDK::StyleEntry e;
+                    e.id = r.GetAttrUInt("id");
+                    e.engName = r.GetAttrText("engName");
+                    styles.push_back(std::move(e));
+                }
+                break;
+
+            case Part::Numberings:
+                if (ln == "numbering")
+                    numberings.push_back(r.GetAttrUInt("id"));
+                break;
+
+            case Part::Bullets:
+                if (ln == "bullet")
+                {
+                    SDK::BulletEntry e;
+                    e.id = r.GetAttrUInt("id");
+                    e.ch = r.GetAttrText("char");
+                    e.checkedCh = r.GetAttrText("checkedChar");
+                    bullets.push_back(std::move(e));
+                    bulletHeadSeen = false;
+                }
+                else if (ln == "paraHead" && !bullets.empty() && !bulletHeadSeen)
+                {
+                    // SDK GetparaHead(0) ϰ ù paraHead
+                    bullets.back().checkable = (r.GetAttrUInt("checkable") != 0);
+                    bulletHeadSeen = true;
+                }
+                break;
+
+            case Part::ParaProps:
+                if (ln == "paraPr")
+                {
+                    SDK::ParaPrEntry e;
+                    e.id = r.GetAttrUInt("id");
+                    paraProps.push_back(e);
+                    headingSeen = false;
+                }
+                else if (ln == "heading" && !paraProps.empty() && !headingSeen)
+                {
+                    // hp:switch ȿ case/default    (case) 
+                    paraProps.back().headingIdRef = r.GetAttrUInt("idRef");
+                    paraProps.back().headingLevel = r.GetAttrUInt("level");
+                    headingSeen = true;
+                }
+                break;
+
+            default:
+                break;
+            }
+        }
+
+        // SDK ο  : Ÿ  numbering  bullet  paraPr
+        if (hasStyles) SDK::InitStyleMap(head, styles);
+        if (hasNumberings) SDK::InitNumberings(head, numberings);
+        if (hasBullets) SDK::InitBullets(head, bullets);
+        if (hasParaProps) SDK::InitParaProperties(head, paraProps);
+
+        return true;
+    }
+
+    bool ReadSectionXml(const Package& pkg, std::size_t index, std::string& xml)
+    {
+        if (index >= pkg.sectionEntries.size()) return false;
+        return ReadZipEntry(pkg.zip, pkg.zip.entries[pkg.sectionEntries[index]], xml);
+    }
+
+    bool HashSectionXml(const Package& pkg, std::size_t index, std::uint64_t& hash)
+    {
+        if (index >= pkg.sectionEntries.size()) return false;
+        return HashZipEntry(pkg.zip, pkg.zip.entries[pkg.sectionEntries[index]], hash);
+    }
+
+    bool LoadSection(const Package& pkg, std::size_t index, SectionTree& tree)
+    {
+        std::string xml;
+        if (!ReadSectionXml(pkg, index, xml)) return false;
+
+        return BuildSectionTree(xml.data(), xml.size(), tree);
+    }
+
+    bool BuildSectionTree(const char* xml, std::size_t size, SectionTree& tree)
+    {
+        tree.nodes.clear();
+        tree.root = nullptr;
+
+        XmlReader r(xml, size);
+        for (;;)
+        {
+            const XmlEvent ev = r.Next();
+            if (ev == XmlEvent::StartElement) break;
+            if (ev != XmlEvent::Text) return false;     // Ʈ  / Ľ 
+        }
+
+        if (!BuildSubtree(r, tree)) return false;
+
+        // Ʈ ڿ /ּ 
+        for (;;)
+        {
+            const XmlEvent ev = r.Next();
+            if (ev == XmlEvent::EndOfDocument) break;
+            if (ev != XmlEvent::Text) return false;
+        }
+        return true;
+    }
+
+    bool BuildSubtree(XmlReader& r, SectionTree& tree)
+    {
+        tree.nodes.clear();
+        tree.root = nullptr;
+
+        std::vector<Node*> stack;
+        stack.reserve(64);
+
+        //  Ҹ ڱ  ȣ (  subtreeSize )
+        std::vector<std::size_t> firstIndex;
+        firstIndex.reserve(64);
+
+        //  StartElement  (¦ Ǵ EndElement)
+        XmlEvent ev = XmlEvent::StartElement;
+        for (;;)
+        {
+            switch (ev)
+            {
+            case XmlEvent::StartElement:
+            {
+                Node& n = tree.nodes.emplace_back();
+                n.id = MapSectionElement(r.LocalName());
+                ReadNodeAttrs(r, n);
+
+                if (stack.empty()) tree.root = &n;
+                else stack.back()->children.push_back(&n);
+
+                stack.push_back(&n);
+                firstIndex.push_back(tree.nodes.size() - 1);
+                break;
+            }
+
+            case XmlEvent::EndElement:
+                stack.back()->subtreeSize = (std::uint32_t)(tree.nodes.size() - firstIndex.back());
+                stack.pop_back();
+                firstIndex.pop_back();
+                if (stack.empty()) return true;
+                break;
+
+            case XmlEvent::Text:
+            {
+                // hp:t ٷ Ʒ ڿ   (SDK CChar )
+                if (stack.back()->id != NODE_TEXT) break;
+
+                Node& ch = tree.nodes.emplace_back();
+                ch.id = NODE_CHAR;
+                r.AppendText(ch.text);
+                stack.back()->children.push_back(&ch);
+                break;
+            }
+
+            default:
+                return false;   //     / Ľ 
+            }
+
+            ev = r.Next();
+        }
+    }
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "native/HwpxNode.h"
+#include "native/XmlReader.h"
+#include "native/ZipArchive.h"
+#include "sdk/SDK_Wrapper.h"
+
+namespace Native
+{
+    // OWPML SDK   .hwpx Ű
+    struct Package
+    {
+        ZipArchive zip;
+        std::vector<std::size_t> sectionEntries;   // Contents/sectionN.xml (N )
+    };
+
+    bool OpenPackage(const std::wstring& path, Package& pkg);
+
+    // Contents/header.xml  (HeadCache ̰ɷ Ű )
+    bool ReadHeadXml(const Package& pkg, std::string& xml);
+
+    // header.xml    ε(Ÿ/numbering/bullet/paraPr) ʱȭ
+    bool ParseHead(const char* xml, std::size_t size, SDK::HeadIndex& head);
+
+    // Contents/sectionN.xml  (Ʈ ȯ Ʈ  ̰  Ľ)
+    bool ReadSectionXml(const Package& pkg, std::size_t index, std::string& xml);
+
+    // Contents/sectionN.xml ׸ ؽ (  ,  ĳ Ű)
+    bool HashSectionXml(const Package& pkg, std::size_t index, std::uint64_t& hash);
+
+    // Contents/sectionN.xml  Ŀ ȸ  Ʈ
+    bool LoadSection(const Package& pkg, std::size_t index, SectionTree& tree);
+
+    bool BuildSectionTree(const char* xml, std::size_t size, SectionTree& tree);
+
+    //  StartElement     ϳ Ʈ 
+    // - ¦ Ǵ EndElement Һ (Ʈ ȯ ǥ  )
+    bool BuildSubtree(XmlReader& r, SectionTree& tree);
+
+    // local name  NodeId, StartElement Ӽ  Node ʵ
+    std::uint32_t MapSectionElement(std::string_view localName);
+    void ReadNodeAttrs(const XmlReader& r, Node& n);
+}
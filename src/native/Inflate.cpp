@@ -0,0 +1,344 @@
+#include "native/Inflate.h"
+
+#include <cstring>
+
+namespace
+{
+    // =========================
+    // Bit reader (LSB-first)
+    // =========================
+    struct BitReader
+    {
+        const std::uint8_t* p = nullptr;
+        const std::uint8_t* end = nullptr;
+        std::uint64_t buf = 0;
+        int cnt = 0;
+        int zeroFill = 0;   // Է  Ѿ ä Ʈ  (ջ )
+
+        void Refill()
+        {
+            while (cnt <= 56)
+            {
+                std::uint64_t b = 0;
+                if (p < end) b = *p++;
+                else zeroFill++;
+                buf |= b << cnt;
+                cnt += 8;
+            }
+        }
+
+        std::uint32_t Peek(int n)
+        {
+            if (cnt < n) Refill();
+            return (std::uint32_t)(buf & ((1ull << n) - 1));
+        }
+
+        void Drop(int n)
+        {
+            buf >>= n;
+            cnt -= n;
+        }
+
+        std::uint32_t Get(int n)
+        {
+            if (n == 0) return 0;
+            const std::uint32_t v = Peek(n);
+            Drop(n);
+            return v;
+        }
+
+        //  Էº 8Ʈ ̻  о ջ
+        bool Overrun() const { return zeroFill > 8; }
+    };
+
+    // =========================
+    // Canonical Huffman
+    // =========================
+    constexpr int MAX_BITS = 15;
+    constexpr int FAST_BITS = 10;
+
+    struct Huffman
+    {
+        // fast: (len << 9) | sym, 0̸ FAST_BITS  ڵ  slow path
+        std::uint16_t fast[1 << FAST_BITS];
+        std::uint16_t count[MAX_BITS + 1];
+        std::uint16_t symbol[288];
+    };
+
+    static std::uint32_t ReverseBits(std::uint32_t code, int len)
+    {
+        std::uint32_t r = 0;
+        for (int i = 0; i < len; ++i)
+        {
+            r = (r << 1) | (code & 1);
+            code >>= 1;
+        }
+        return r;
+    }
+
+    static bool BuildHuffman(Huffman& h, const std::uint8_t* lengths, int n)
+    {
+        std::memset(h.fast, 0, sizeof(h.fast));
+        std::memset(h.count, 0, sizeof(h.count));
+
+        for (int i = 0; i < n; ++i) h.count[lengths[i]]++;
+        h.count[0] = 0;
+
+        // over-subscribed ˻ (incomplete : Ÿ ڵ 1¥ )
+        int left = 1;
+        for (int len = 1; len <= MAX_BITS; ++len)
+        {
+            left <<= 1;
+            left -= h.count[len];
+            if (left < 0) return false;
+        }
+
+        std::uint16_t offs[MAX_BITS + 2];
+        offs[1] = 0;
+        for (int len = 1; len <= MAX_BITS; ++len)
+            offs[len + 1] = (std::uint16_t)(offs[len] + h.count[len]);
+
+        for (int i = 0; i < n; ++i)
+        {
+            if (lengths[i] != 0)
+                h.symbol[offs[lengths[i]]++] = (std::uint16_t)i;
+        }
+
+        // fast table (bit-reversed code)
+        std::uint32_t code = 0;
+        int index = 0;
+        for (int len = 1; len <= MAX_BITS; ++len)
+        {
+            for (int k = 0; k < h.count[len]; ++k, ++index, ++code)
+            {
+                if (len > FAST_BITS) continue;
+
+                const std::uint32_t rev = ReverseBits(code, len);
+                const std::uint16_t entry = (std::uint16_t)((len << 9) | h.symbol[index]);
+                for (std::uint32_t fill = rev; fill < (1u << FAST_BITS); fill += (1u << len))
+                    h.fast[fill] = entry;
+            }
+            code <<= 1;
+        }
+
+        return true;
+    }
+
+    static int Decode(BitReader& br, const Huffman& h)
+    {
+        const std::uint16_t e = h.fast[br.Peek(FAST_BITS)];
+        if (e)
+        {
+            br.Drop(e >> 9);
+            return e & 511;
+        }
+
+        // slow path:  Ʈ canonical ڵ
+        const std::uint32_t bits = br.Peek(MAX_BITS);
+        int code = 0, first = 0, index = 0;
+        for (int len = 1; len <= MAX_BITS; ++len)
+        {
+            code |= (int)((bits >> (len - 1)) & 1);
+            const int count = h.count[len];
+            if (code - count < first)
+            {
+                br.Drop(len);
+                return h.symbol[index + (code - first)];
+            }
+            index += count;
+            first += count;
+            first <<= 1;
+            code <<= 1;
+        }
+        return -1;
+    }
+
+    // =========================
+    // Length / distance tables
+    // =========================
+    const std::uint16_t kLenBase[29] = {
+        3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+        35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+    const std::uint8_t kLenExtra[29] = {
+        0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+        3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+    const std::uint16_t kDistBase[30] = {
+        1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+        257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+    const std::uint8_t kDistExtra[30] = {
+        0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+        7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+
+    static bool InflateCodes(BitReader& br, std::string& out, std::size_t limit, const Huffman& lit, const Huffman& dist)
+    {
+        for (;;)
+        {
+            const int sym = Decode(br, lit);
+            if (sym < 0 || br.Overrun()) return false;
+
+            if (sym < 256)
+            {
+                if (out.size() >= limit) return false;
+                out.push_back((char)sym);
+                continue;
+            }
+            if (sym == 256) return true;
+
+            const int li = sym - 257;
+            if (li >= 29) return false;
+            const std::size_t len = kLenBase[li] + br.Get(kLenExtra[li]);
+
+            const int ds = Decode(br, dist);
+            if (ds < 0 || ds >= 30) return false;
+            const std::size_t d = kDistBase[ds] + br.Get(kDistExtra[ds]);
+            if (d > out.size()) return false;
+            if (len > limit - out.size()) return false;
+
+            // ġ (d < len) ϹǷ Ʈ 
+            std::size_t from = out.size() - d;
+            out.resize(out.size() + len);
+            char* o = &out[0];
+            std::size_t to = out.size() - len;
+            for (std::size_t i = 0; i < len; ++i)
+                o[to + i] = o[from + i];
+        }
+    }
+
+    static bool InflateStored(BitReader& br, std::string& out, std::size_t limit)
+    {
+        br.Drop(br.cnt & 7);   // Ʈ  
+
+        const std::uint32_t len = br.Get(16);
+        const std::uint32_t nlen = br.Get(16);
+        if ((len ^ 0xFFFFu) != nlen) return false;
+        if (len > limit - out.size()) return false;
+
+        for (std::uint32_t i = 0; i < len; ++i)
+        {
+            out.push_back((char)br.Get(8));
+            if (br.Overrun()) return false;
+        }
+        return true;
+    }
+
+    struct FixedTables
+    {
+        Huffman lit;
+        Huffman dist;
+
+        FixedTables()
+        {
+            std::uint8_t lengths[288];
+            int i = 0;
+            for (; i < 144; ++i) lengths[i] = 8;
+            for (; i < 256; ++i) lengths[i] = 9;
+            for (; i < 280; ++i) lengths[i] = 7;
+            for (; i < 288; ++i) lengths[i] = 8;
+            BuildHuffman(lit, lengths, 288);
+
+            for (i = 0; i < 30; ++i) lengths[i] = 5;
+            BuildHuffman(dist, lengths, 30);
+        }
+    };
+
+    static bool InflateFixed(BitReader& br, std::string& out, std::size_t limit)
+    {
+        static const FixedTables tables;
+        return InflateCodes(br, out, limit, tables.lit, tables.dist);
+    }
+
+    static bool InflateDynamic(BitReader& br, std::string& out, std::size_t limit)
+    {
+        static const std::uint8_t kOrder[19] = { 16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+
+        const int nlen = (int)br.Get(5) + 257;
+        const int ndist = (int)br.Get(5) + 1;
+        const int ncode = (int)br.Get(4) + 4;
+        if (nlen > 286 || ndist > 30) return false;
+
+        std::uint8_t lengths[288 + 32] = {};
+        for (int i = 0; i < ncode; ++i)
+            lengths[kOrder[i]] = (std::uint8_t)br.Get(3);
+
+        Huffman lencode;
+        if (!BuildHuffman(lencode, lengths, 19)) return false;
+
+        int index = 0;
+        while (index < nlen + ndist)
+        {
+            const int sym = Decode(br, lencode);
+            if (sym < 0 || br.Overrun()) return false;
+
+            if (sym < 16)
+            {
+                lengths[index++] = (std::uint8_t)sym;
+                continue;
+            }
+
+            std::uint8_t value = 0;
+            int repeat = 0;
+            if (sym == 16)
+            {
+                if (index == 0) return false;
+                value = lengths[index - 1];
+                repeat = 3 + (int)br.Get(2);
+            }
+            else if (sym == 17)
+            {
+                repeat = 3 + (int)br.Get(3);
+            }
+            else
+            {
+                repeat = 11 + (int)br.Get(7);
+            }
+
+            if (index + repeat > nlen + ndist) return false;
+            while (repeat--) lengths[index++] = value;
+        }
+
+        if (lengths[256] == 0) return false;   // end-of-block ڵ ʼ
+
+        Huffman lit, dist;
+        if (!BuildHuffman(lit, lengths, nlen)) return false;
+        if (!BuildHuffman(dist, lengths + nlen, ndist)) return false;
+
+        return InflateCodes(br, out, limit, lit, dist);
+    }
+}
+
+namespace Native
+{
+    bool InflateRaw(const std::uint8_t* src, std::size_t srcSize, std::string& out, std::size_t maxSize)
+    {
+        out.clear();
+        if (!src) return false;
+
+        // ̸  ũ  Է¿   ִ ŭ (maxSize  ̶  )
+        const std::size_t reachable = (srcSize > SIZE_MAX / MAX_DEFLATE_RATIO) ? SIZE_MAX : srcSize * MAX_DEFLATE_RATIO;
+        out.reserve(maxSize < reachable ? maxSize : reachable);
+
+        BitReader br;
+        br.p = src;
+        br.end = src + srcSize;
+
+        bool last = false;
+        while (!last)
+        {
+            last = br.Get(1) != 0;
+            const std::uint32_t type = br.Get(2);
+
+            bool ok = false;
+            switch (type)
+            {
+            case 0: ok = InflateStored(br, out, maxSize); break;
+            case 1: ok = InflateFixed(br, out, maxSize); break;
+            case 2: ok = InflateDynamic(br, out, maxSize); break;
+            default: ok = false; break;
+            }
+
+            if (!ok || br.Overrun()) return false;
+        }
+
+        return true;
+    }
+}
@@ -0,0 +1,17 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace Native
+{
+    // DEFLATE   ִ ִ  ( 258  ϳ ּ 2Ʈ)
+    constexpr std::size_t MAX_DEFLATE_RATIO = 1032;
+
+    // raw DEFLATE(RFC 1951) Ʈ  (zip method 8 , zlib  )
+    // - maxSize:   ũ  (zip  ũ)  Ѵ  ߴϰ false
+    //   ̸ reserveϴ ũ srcSize * MAX_DEFLATE_RATIO Ϸ ڸ (۵  ū Ҵ )
+    // - ջ Ʈ̸ false
+    bool InflateRaw(const std::uint8_t* src, std::size_t srcSize, std::string& out, std::size_t maxSize);
+}
@@ -0,0 +1,137 @@
+#include "native/MappedFile.h"
+#include "native/WidePath.h"
+
+#include <utility>
+
+#ifdef _WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Native
+{
+    MappedFile::~MappedFile()
+    {
+        Close();
+    }
+
+    MappedFile::MappedFile(MappedFile&& other) noexcept
+    {
+        *this = std::move(other);
+    }
+
+    MappedFile& MappedFile::operator=(MappedFile&& other) noexcept
+    {
+        if (this == &other) return *this;
+
+        Close();
+        std::swap(m_data, other.m_data);
+        std::swap(m_size, other.m_size);
+#ifdef _WIN32
+        std::swap(m_file, other.m_file);
+        std::swap(m_mapping, other.m_mapping);
+#endif
+        return *this;
+    }
+
+#ifdef _WIN32
+    bool MappedFile::Open(const std::wstring& path)
+    {
+        Close();
+
+        HANDLE file = CreateFileW(ToPath(path).c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+            OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE) return false;
+        m_file = file;
+
+        LARGE_INTEGER size;
+        if (!GetFileSizeEx(file, &size) || size.QuadPart <= 0
+            || (unsigned long long)size.QuadPart > (unsigned long long)SIZE_MAX)
+        {
+            Close();
+            return false;
+        }
+
+        HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!mapping) { Close(); return false; }
+        m_mapping = mapping;
+
+        const void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        if (!view) { Close(); return false; }
+
+        m_data = (const std::uint8_t*)view;
+        m_size = (std::size_t)size.QuadPart;
+        return true;
+    }
+
+    void MappedFile::Close()
+    {
+        if (m_data) UnmapViewOfFile(m_data);
+        if (m_mapping) CloseHandle((HANDLE)m_mapping);
+        if (m_file) CloseHandle((HANDLE)m_file);
+
+        m_data = nullptr;
+        m_size = 0;
+        m_mapping = nullptr;
+        m_file = nullptr;
+    }
+
+    void MappedFile::WillRead(std::size_t, std::size_t) const
+    {
+        //  Ʈ  ̸ б  (PrefetchVirtualMemory Windows 8 ̶̻  )
+    }
+#else
+    bool MappedFile::Open(const std::wstring& path)
+    {
+        Close();
+
+        const int fd = ::open(ToPath(path).c_str(), O_RDONLY | O_CLOEXEC);
+        if (fd < 0) return false;
+
+        struct stat st;
+        if (::fstat(fd, &st) != 0 || st.st_size <= 0
+            || (unsigned long long)st.st_size > (unsigned long long)SIZE_MAX)
+        {
+            ::close(fd);
+            return false;
+        }
+
+        void* view = ::mmap(nullptr, (std::size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);    //  fd ݾƵ 
+        if (view == MAP_FAILED) return false;
+
+        m_data = (const std::uint8_t*)view;
+        m_size = (std::size_t)st.st_size;
+        return true;
+    }
+
+    void MappedFile::Close()
+    {
+        if (m_data) ::munmap((void*)m_data, m_size);
+
+        m_data = nullptr;
+        m_size = 0;
+    }
+
+    void MappedFile::WillRead(std::size_t offset, std::size_t size) const
+    {
+        if (!m_data || offset >= m_size) return;
+        if (size > m_size - offset) size = m_size - offset;
+
+        // madvise  迡 ؾ 
+        const std::size_t page = (std::size_t)::sysconf(_SC_PAGESIZE);
+        const std::size_t start = offset - offset % page;
+        ::madvise((void*)(m_data + start), size + (offset - start), MADV_WILLNEED);
+    }
+#endif
+}
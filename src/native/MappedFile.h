@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace Native
+{
+    // б  ޸  
+    // -   θ ϰ     ǵ帰  ũ ö
+    //   (.hwpx BinData ̹/̸ó   ׸ , RSS  )
+    // -   (clean)̶ ޸𸮰 ڶ OS ׳ 
+    // -  Ұ, ̵  (Ҹ   )
+    class MappedFile
+    {
+    public:
+        MappedFile() = default;
+        ~MappedFile();
+
+        MappedFile(const MappedFile&) = delete;
+        MappedFile& operator=(const MappedFile&) = delete;
+        MappedFile(MappedFile&& other) noexcept;
+        MappedFile& operator=(MappedFile&& other) noexcept;
+
+        //   /    false
+        bool Open(const std::wstring& path);
+        void Close();
+
+        const std::uint8_t* Data() const { return m_data; }
+        std::size_t Size() const { return m_size; }
+
+        // [offset, offset+size)     Ŷ OS ˸ (̸ б)
+        void WillRead(std::size_t offset, std::size_t size) const;
+
+    private:
+        const std::uint8_t* m_data = nullptr;
+        std::size_t m_size = 0;
+#ifdef _WIN32
+        void* m_file = nullptr;         // HANDLE
+        void* m_mapping = nullptr;      // HANDLE
+#endif
+    };
+}
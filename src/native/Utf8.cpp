@@ -0,0 +1,503 @@
+#include "native/Utf8.h"
+
+#include <cwctype>
+
+#if defined(_M_X64) || defined(__x86_64__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || (defined(__i386__) && defined(__SSE2__))
+#define HWPX_UTF16_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#else
+#define HWPX_UTF16_X86 0
+#endif
+
+namespace
+{
+    // UTF-8   ؼ (AppendUtf8AsWide Ģ)
+    // - p:  Ʈ(0x80 ̻), /п ϰ  ġ ̵
+    // - ȯ: ڵƮ (߸  0xFFFD)
+    static std::uint32_t DecodeUtf8Seq(const unsigned char*& p, const unsigned char* end)
+    {
+        std::uint32_t cp = 0;
+        int extra = 0;
+        if ((*p & 0xE0) == 0xC0) { cp = *p & 0x1F; extra = 1; }
+        else if ((*p & 0xF0) == 0xE0) { cp = *p & 0x0F; extra = 2; }
+        else if ((*p & 0xF8) == 0xF0) { cp = *p & 0x07; extra = 3; }
+        else { ++p; return 0xFFFD; }
+
+        if (end - p <= extra)
+        {
+            p = end;
+            return 0xFFFD;
+        }
+
+        ++p;
+        for (int i = 0; i < extra; ++i, ++p)
+        {
+            if ((*p & 0xC0) != 0x80) return 0xFFFD;
+            cp = (cp << 6) | (*p & 0x3F);
+        }
+        return cp;
+    }
+
+    static bool IsHighSurrogate(std::uint32_t c) { return c >= 0xD800 && c <= 0xDBFF; }
+    static bool IsLowSurrogate(std::uint32_t c) { return c >= 0xDC00 && c <= 0xDFFF; }
+
+    static std::uint32_t CombineSurrogates(std::uint32_t hi, std::uint32_t lo)
+    {
+        return 0x10000 + ((hi - 0xD800) << 10) + (lo - 0xDC00);
+    }
+
+    // ڵƮ ϳ dst (AppendCodePointUtf8  Ģ)
+    static char* EncodeCodePointUtf8(char* dst, std::uint32_t cp)
+    {
+        if (cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF)) cp = 0xFFFD;
+
+        if (cp < 0x80)
+        {
+            *dst++ = (char)cp;
+        }
+        else if (cp < 0x800)
+        {
+            *dst++ = (char)(0xC0 | (cp >> 6));
+            *dst++ = (char)(0x80 | (cp & 0x3F));
+        }
+        else if (cp < 0x10000)
+        {
+            *dst++ = (char)(0xE0 | (cp >> 12));
+            *dst++ = (char)(0x80 | ((cp >> 6) & 0x3F));
+            *dst++ = (char)(0x80 | (cp & 0x3F));
+        }
+        else
+        {
+            *dst++ = (char)(0xF0 | (cp >> 18));
+            *dst++ = (char)(0x80 | ((cp >> 12) & 0x3F));
+            *dst++ = (char)(0x80 | ((cp >> 6) & 0x3F));
+            *dst++ = (char)(0x80 | (cp & 0x3F));
+        }
+        return dst;
+    }
+
+    // ---------------------------------------------------------
+    // Į  (wchar_t 16/32bit, char16_t )
+    // ---------------------------------------------------------
+    template <class UnitT>
+    void AppendUnitsScalar(std::string& out, const UnitT* s, std::size_t n, std::uint32_t& pendingHigh)
+    {
+        std::size_t i = 0;
+
+        //    high surrogate
+        if (pendingHigh != 0 && n > 0)
+        {
+            const std::uint32_t lo = (std::uint32_t)s[0];
+            if (IsLowSurrogate(lo))
+            {
+                Native::AppendCodePointUtf8(out, CombineSurrogates(pendingHigh, lo));
+                i = 1;
+            }
+            else
+            {
+                Native::AppendCodePointUtf8(out, 0xFFFD);
+            }
+            pendingHigh = 0;
+        }
+
+        for (; i < n; ++i)
+        {
+            std::uint32_t cp = (std::uint32_t)s[i];
+
+            if (cp < 0x80)
+            {
+                out.push_back((char)cp);
+                continue;
+            }
+
+            if (IsHighSurrogate(cp))
+            {
+                if (i + 1 == n)
+                {
+                    pendingHigh = cp;   //   
+                    return;
+                }
+
+                const std::uint32_t lo = (std::uint32_t)s[i + 1];
+                if (IsLowSurrogate(lo))
+                {
+                    cp = CombineSurrogates(cp, lo);
+                    ++i;
+                }
+            }
+
+            Native::AppendCodePointUtf8(out, cp);
+        }
+    }
+
+    // ---------------------------------------------------------
+    // UTF-16  
+    // - Ŀ: 8  ó  ִ ŭ óϰ ó   ȯ
+    //   (surrogate  , SSE2  ASCII ƴ Ͽ )
+    // -   Į  ϸ ѱ ٽ Ŀη
+    // - Է SIMD εθ  (wchar_t/char16_t  ̵  Ŀ)
+    // ---------------------------------------------------------
+    constexpr std::size_t BLOCK_UNITS = 8;
+    constexpr std::size_t STORE_SLACK = 16;     //   16Ʈ ° 
+
+    using EncodeBlocksFn = std::size_t(*)(char*& dst, const void* src, std::size_t n);
+
+#if HWPX_UTF16_X86
+    // 4(32bit )     ũ/ Ʈ 
+    // - ε: 1Ʈ  Ʈ( 4) | 2Ʈ   Ʈ( 4)
+    struct ShuffleTable
+    {
+        alignas(16) unsigned char shuf[256][16];
+        unsigned char len[256];
+
+        constexpr ShuffleTable() : shuf(), len()
+        {
+            for (unsigned int idx = 0; idx < 256; ++idx)
+            {
+                unsigned int pos = 0;
+                for (unsigned int lane = 0; lane < 4; ++lane)
+                {
+                    const unsigned int bytes =
+                        ((idx >> lane) & 1) ? 1 : ((idx >> (lane + 4)) & 1) ? 2 : 3;
+                    for (unsigned int b = 0; b < bytes; ++b)
+                        shuf[idx][pos++] = (unsigned char)(lane * 4 + b);
+                }
+                len[idx] = (unsigned char)pos;
+                for (; pos < 16; ++pos) shuf[idx][pos] = 0x80;     // 0 ä
+            }
+        }
+    };
+
+    constexpr ShuffleTable SHUFFLE_TABLE{};
+
+    inline bool IsAsciiBlock(__m128i v)
+    {
+        const __m128i hi = _mm_and_si128(v, _mm_set1_epi16((short)0xFF80));
+        return _mm_movemask_epi8(_mm_cmpeq_epi16(hi, _mm_setzero_si128())) == 0xFFFF;
+    }
+
+    inline bool HasSurrogate(__m128i v)
+    {
+        const __m128i top = _mm_and_si128(v, _mm_set1_epi16((short)0xF800));
+        return _mm_movemask_epi8(_mm_cmpeq_epi16(top, _mm_set1_epi16((short)0xD800))) != 0;
+    }
+
+    std::size_t EncodeBlocksSse2(char*& dst, const void* src, std::size_t n)
+    {
+        const unsigned char* p = (const unsigned char*)src;
+
+        std::size_t i = 0;
+        for (; i + BLOCK_UNITS <= n; i += BLOCK_UNITS)
+        {
+            const __m128i v = _mm_loadu_si128((const __m128i*)(p + i * 2));
+            if (!IsAsciiBlock(v)) break;
+
+            _mm_storel_epi64((__m128i*)dst, _mm_packus_epi16(v, v));
+            dst += BLOCK_UNITS;
+        }
+        return i;
+    }
+
+    // BMP  4(32bit , surrogate )
+#if defined(__GNUC__) && !defined(__SSSE3__)
+    __attribute__((target("ssse3")))
+#endif
+    inline char* Encode4(char* dst, __m128i u)
+    {
+        const __m128i m3f = _mm_set1_epi32(0x3F);
+        const __m128i cont = _mm_set1_epi32(0x80);
+
+        // 2Ʈ: C0|u>>6, 80|u&3F
+        const __m128i t2 = _mm_or_si128(
+            _mm_or_si128(_mm_srli_epi32(u, 6), _mm_set1_epi32(0xC0)),
+            _mm_slli_epi32(_mm_or_si128(_mm_and_si128(u, m3f), cont), 8));
+
+        // 3Ʈ: E0|u>>12, 80|(u>>6)&3F, 80|u&3F
+        const __m128i t3 = _mm_or_si128(
+            _mm_or_si128(_mm_srli_epi32(u, 12), _mm_set1_epi32(0xE0)),
+            _mm_or_si128(
+                _mm_slli_epi32(_mm_or_si128(_mm_and_si128(_mm_srli_epi32(u, 6), m3f), cont), 8),
+                _mm_slli_epi32(_mm_or_si128(_mm_and_si128(u, m3f), cont), 16)));
+
+        const __m128i is1 = _mm_cmplt_epi32(u, _mm_set1_epi32(0x80));
+        const __m128i is2 = _mm_cmplt_epi32(u, _mm_set1_epi32(0x800));
+
+        __m128i lanes = _mm_or_si128(_mm_and_si128(is2, t2), _mm_andnot_si128(is2, t3));
+        lanes = _mm_or_si128(_mm_and_si128(is1, u), _mm_andnot_si128(is1, lanes));
+
+        const unsigned int idx =
+            (unsigned int)_mm_movemask_ps(_mm_castsi128_ps(is1)) |
+            ((unsigned int)_mm_movemask_ps(_mm_castsi128_ps(is2)) << 4);
+
+        const __m128i mask = _mm_load_si128((const __m128i*)SHUFFLE_TABLE.shuf[idx]);
+        _mm_storeu_si128((__m128i*)dst, _mm_shuffle_epi8(lanes, mask));
+        return dst + SHUFFLE_TABLE.len[idx];
+    }
+
+#if defined(__GNUC__) && !defined(__SSSE3__)
+    __attribute__((target("ssse3")))
+#endif
+    std::size_t EncodeBlocksSsse3(char*& dst, const void* src, std::size_t n)
+    {
+        const unsigned char* p = (const unsigned char*)src;
+        const __m128i zero = _mm_setzero_si128();
+
+        std::size_t i = 0;
+        for (; i + BLOCK_UNITS <= n; i += BLOCK_UNITS)
+        {
+            const __m128i v = _mm_loadu_si128((const __m128i*)(p + i * 2));
+
+            if (IsAsciiBlock(v))
+            {
+                _mm_storel_epi64((__m128i*)dst, _mm_packus_epi16(v, v));
+                dst += BLOCK_UNITS;
+                continue;
+            }
+
+            if (HasSurrogate(v)) break;
+
+            dst = Encode4(dst, _mm_unpacklo_epi16(v, zero));
+            dst = Encode4(dst, _mm_unpackhi_epi16(v, zero));
+        }
+        return i;
+    }
+
+    bool CpuHasSsse3()
+    {
+#if defined(_MSC_VER)
+        int info[4] = {};
+        __cpuid(info, 1);
+        return (info[2] & (1 << 9)) != 0;
+#else
+        return __builtin_cpu_supports("ssse3") != 0;
+#endif
+    }
+
+    EncodeBlocksFn SelectEncodeBlocks()
+    {
+        return CpuHasSsse3() ? EncodeBlocksSsse3 : EncodeBlocksSse2;
+    }
+#else
+    std::size_t EncodeBlocksNone(char*&, const void*, std::size_t)
+    {
+        return 0;
+    }
+
+    EncodeBlocksFn SelectEncodeBlocks()
+    {
+        return EncodeBlocksNone;
+    }
+#endif
+
+    template <class UnitT>
+    void AppendUtf16Blocks(std::string& out, const UnitT* s, std::size_t n, std::uint32_t& pendingHigh)
+    {
+        static_assert(sizeof(UnitT) == 2, "UTF-16 code unit");
+        static const EncodeBlocksFn encodeBlocks = SelectEncodeBlocks();
+
+        if (n == 0) return;
+
+        // ڴ ִ 3Ʈ (pair 2  4Ʈ) +   high  +  
+        const std::size_t base = out.size();
+        out.resize(base + n * 3 + 3 + STORE_SLACK);
+        char* const begin = &out[base];
+        char* dst = begin;
+
+        std::size_t i = 0;
+        if (pendingHigh != 0)
+        {
+            const std::uint32_t lo = (std::uint32_t)s[0];
+            if (IsLowSurrogate(lo))
+            {
+                dst = EncodeCodePointUtf8(dst, CombineSurrogates(pendingHigh, lo));
+                i = 1;
+            }
+            else
+            {
+                dst = EncodeCodePointUtf8(dst, 0xFFFD);
+            }
+            pendingHigh = 0;
+        }
+
+        while (i < n)
+        {
+            i += encodeBlocks(dst, s + i, n - i);
+
+            // Ŀ  (Ǵ 8 ̸ ) Į
+            const std::size_t stop = (n - i < BLOCK_UNITS) ? n : i + BLOCK_UNITS;
+            while (i < stop)
+            {
+                std::uint32_t cp = (std::uint32_t)s[i++];
+
+                if (cp < 0x80)
+                {
+                    *dst++ = (char)cp;
+                    continue;
+                }
+
+                if (IsHighSurrogate(cp))
+                {
+                    if (i == n)
+                    {
+                        pendingHigh = cp;   //   
+                        break;
+                    }
+
+                    const std::uint32_t lo = (std::uint32_t)s[i];
+                    if (IsLowSurrogate(lo))
+                    {
+                        cp = CombineSurrogates(cp, lo);
+                        ++i;
+                    }
+                }
+
+                dst = EncodeCodePointUtf8(dst, cp);
+            }
+        }
+
+        out.resize(base + (std::size_t)(dst - begin));
+    }
+}
+
+namespace Native
+{
+    void AppendCodePointWide(std::wstring& out, std::uint32_t cp)
+    {
+        if constexpr (sizeof(wchar_t) == 2)
+        {
+            if (cp >= 0x10000)
+            {
+                cp -= 0x10000;
+                out.push_back((wchar_t)(0xD800 + (cp >> 10)));
+                out.push_back((wchar_t)(0xDC00 + (cp & 0x3FF)));
+                return;
+            }
+        }
+        out.push_back((wchar_t)cp);
+    }
+
+    void AppendCodePointUtf8(std::string& out, std::uint32_t cp)
+    {
+        if (cp > 0x10FFFF || (cp >= 0xD800 && cp <= 0xDFFF)) cp = 0xFFFD;
+
+        if (cp < 0x80)
+        {
+            out.push_back((char)cp);
+        }
+        else if (cp < 0x800)
+        {
+            out.push_back((char)(0xC0 | (cp >> 6)));
+            out.push_back((char)(0x80 | (cp & 0x3F)));
+        }
+        else if (cp < 0x10000)
+        {
+            out.push_back((char)(0xE0 | (cp >> 12)));
+            out.push_back((char)(0x80 | ((cp >> 6) & 0x3F)));
+            out.push_back((char)(0x80 | (cp & 0x3F)));
+        }
+        else
+        {
+            out.push_back((char)(0xF0 | (cp >> 18)));
+            out.push_back((char)(0x80 | ((cp >> 12) & 0x3F)));
+            out.push_back((char)(0x80 | ((cp >> 6) & 0x3F)));
+            out.push_back((char)(0x80 | (cp & 0x3F)));
+        }
+    }
+
+    void AppendUtf8AsWide(std::wstring& out, const char* s, std::size_t n)
+    {
+        const unsigned char* p = (const unsigned char*)s;
+        const unsigned char* end = p + n;
+
+        while (p < end)
+        {
+            // ASCII  ٷ 
+            if (*p < 0x80)
+            {
+                out.push_back((wchar_t)*p++);
+                continue;
+            }
+
+            AppendCodePointWide(out, DecodeUtf8Seq(p, end));
+        }
+    }
+
+    void AppendUtf8Sanitized(std::string& out, const char* s, std::size_t n)
+    {
+        const unsigned char* p = (const unsigned char*)s;
+        const unsigned char* end = p + n;
+
+        while (p < end)
+        {
+            // ASCII    
+            const unsigned char* run = p;
+            while (p < end && *p < 0x80) ++p;
+            out.append((const char*)run, (std::size_t)(p - run));
+            if (p >= end) break;
+
+            // ùٸ   Ʈ ״
+            const unsigned char* seq = p;
+            const std::uint32_t cp = DecodeUtf8Seq(p, end);
+            const bool canonical =
+                cp != 0xFFFD && cp <= 0x10FFFF && !(cp >= 0xD800 && cp <= 0xDFFF) &&
+                (std::size_t)(p - seq) == (cp < 0x800 ? 2u : cp < 0x10000 ? 3u : 4u) && cp >= 0x80;
+
+            if (canonical) out.append((const char*)seq, (std::size_t)(p - seq));
+            else AppendCodePointUtf8(out, cp);
+        }
+    }
+
+    void AppendWideAsUtf8(std::string& out, const wchar_t* s, std::size_t n, std::uint32_t& pendingHigh)
+    {
+        if constexpr (sizeof(wchar_t) == 2) AppendUtf16Blocks(out, s, n, pendingHigh);
+        else AppendUnitsScalar(out, s, n, pendingHigh);
+    }
+
+    void AppendUtf16AsUtf8(std::string& out, const char16_t* s, std::size_t n, std::uint32_t& pendingHigh)
+    {
+        AppendUtf16Blocks(out, s, n, pendingHigh);
+    }
+
+    void AppendUtf16AsUtf8Scalar(std::string& out, const char16_t* s, std::size_t n, std::uint32_t& pendingHigh)
+    {
+        AppendUnitsScalar(out, s, n, pendingHigh);
+    }
+
+    void FinishWideAsUtf8(std::string& out, std::uint32_t& pendingHigh)
+    {
+        if (pendingHigh == 0) return;
+        AppendCodePointUtf8(out, 0xFFFD);
+        pendingHigh = 0;
+    }
+
+    void AppendWideAsUtf8(std::string& out, const std::wstring& s)
+    {
+        std::uint32_t pendingHigh = 0;
+        AppendWideAsUtf8(out, s.data(), s.size(), pendingHigh);
+        FinishWideAsUtf8(out, pendingHigh);
+    }
+
+    bool Utf8HasNonSpace(std::string_view s)
+    {
+        const unsigned char* p = (const unsigned char*)s.data();
+        const unsigned char* end = p + s.size();
+
+        while (p < end)
+        {
+            if (*p < 0x80)
+            {
+                if (!iswspace((wint_t)*p)) return true;
+                ++p;
+                continue;
+            }
+
+            const std::uint32_t cp = DecodeUtf8Seq(p, end);
+            if (cp > 0xFFFF && sizeof(wchar_t) == 2) return true;   // BMP   
+            if (!iswspace((wint_t)cp)) return true;
+        }
+        return false;
+    }
+}
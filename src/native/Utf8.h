@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace Native
+{
+    // =========================================================
+    // UTF-8  wide ȯ ( UTF-8 Ʈ ۷ ٷ)
+    // - ߸ UTF-8 / ¦  surrogate /   ڵƮ  U+FFFD
+    //   (WideCharToMultiByte ⺻ ۰  )
+    // - ũ  size_t (2GB Ѿ int ߸ )
+    // =========================================================
+
+    // ڵƮ ϳ
+    void AppendCodePointWide(std::wstring& out, std::uint32_t cp);     // wchar_t 16bit surrogate pair
+    void AppendCodePointUtf8(std::string& out, std::uint32_t cp);
+
+    // UTF-8  wide
+    void AppendUtf8AsWide(std::wstring& out, const char* s, std::size_t n);
+
+    // UTF-8  UTF-8 (AppendUtf8AsWide  ٽ ڵ Ͱ  Ʈ, ߸ Ʈ U+FFFD)
+    void AppendUtf8Sanitized(std::string& out, const char* s, std::size_t n);
+
+    // wide  UTF-8 ( )
+    // - pendingHigh:    ɸ high surrogate ( 0)
+    //    迡 ģ pair  ڷ  (wchar_t 16bit ȯ)
+    // - wchar_t 16bit AppendUtf16AsUtf8 ( )
+    void AppendWideAsUtf8(std::string& out, const wchar_t* s, std::size_t n, std::uint32_t& pendingHigh);
+    void FinishWideAsUtf8(std::string& out, std::uint32_t& pendingHigh);  //  high  U+FFFD
+
+    // UTF-16  UTF-8 ( , pendingHigh Ģ  )
+    // - x86: 8ھ  ó. ASCII  SSE2 , 1/2/3Ʈ  (ѱ+/ȣ)
+    //   SSSE3(Ÿ Ȯ)    . surrogate  ϸ  ھ
+    // -   CPU Į
+    void AppendUtf16AsUtf8(std::string& out, const char16_t* s, std::size_t n, std::uint32_t& pendingHigh);
+
+    //    Į  (/ġ )
+    void AppendUtf16AsUtf8Scalar(std::string& out, const char16_t* s, std::size_t n, std::uint32_t& pendingHigh);
+
+    // wide  UTF-8 (   ڿ)
+    void AppendWideAsUtf8(std::string& out, const std::wstring& s);
+
+    // (iswspace) ƴ ڰ ϳ ִ (UTF-8 ״ ˻)
+    bool Utf8HasNonSpace(std::string_view s);
+}
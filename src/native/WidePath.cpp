@@ -0,0 +1,35 @@
+#include "native/WidePath.h"
+#include "native/Utf8.h"
+
+namespace Native
+{
+#ifdef _WIN32
+    std::filesystem::path ToPath(const std::wstring& path)
+    {
+        return std::filesystem::path(path);
+    }
+
+    std::wstring FromPath(const std::filesystem::path& path)
+    {
+        return path.wstring();
+    }
+#else
+    std::filesystem::path ToPath(const std::wstring& path)
+    {
+        std::string utf8;
+        utf8.reserve(path.size() + path.size() / 2);
+        AppendWideAsUtf8(utf8, path);
+
+        return std::filesystem::u8path(utf8);
+    }
+
+    std::wstring FromPath(const std::filesystem::path& path)
+    {
+        const std::string utf8 = path.u8string();
+
+        std::wstring w;
+        AppendUtf8AsWide(w, utf8.data(), utf8.size());
+        return w;
+    }
+#endif
+}
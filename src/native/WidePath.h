@@ -0,0 +1,13 @@
+#pragma once
+
+#include <filesystem>
+#include <string>
+
+namespace Native
+{
+    // wstring   std::filesystem::path
+    // - Windows: ״ (path ΰ wide)
+    // -  : UTF-8 ȯ (libstdc++ ⺻ ȯ "C" Ķ̶ ѱ ο )
+    std::filesystem::path ToPath(const std::wstring& path);
+    std::wstring FromPath(const std::filesystem::path& path);
+}
@@ -0,0 +1,401 @@
+#include "native/XmlReader.h"
+
+#include <cstring>
+
+namespace
+{
+    static bool IsXmlSpace(char c)
+    {
+        return c == ' ' || c == '\t' || c == '\r' || c == '\n';
+    }
+
+    static bool IsNameEnd(char c)
+    {
+        return IsXmlSpace(c) || c == '>' || c == '/' || c == '=';
+    }
+
+    static bool StartsWith(const char* p, const char* end, const char* lit)
+    {
+        const std::size_t n = std::strlen(lit);
+        return (std::size_t)(end - p) >= n && std::memcmp(p, lit, n) == 0;
+    }
+
+    static std::string_view LocalPart(std::string_view name)
+    {
+        const std::size_t colon = name.rfind(':');
+        return (colon == std::string_view::npos) ? name : name.substr(colon + 1);
+    }
+
+    // &...; ϳ ؼ.   p ';'  ̵
+    static bool DecodeEntity(const char*& p, const char* end, std::uint32_t& cp)
+    {
+        const char* semi = p + 1;
+        while (semi < end && *semi != ';' && semi - p < 12) ++semi;
+        if (semi >= end || *semi != ';') return false;
+
+        const std::string_view ent(p + 1, (std::size_t)(semi - p - 1));
+
+        if (ent == "lt") cp = '<';
+        else if (ent == "gt") cp = '>';
+        else if (ent == "amp") cp = '&';
+        else if (ent == "quot") cp = '"';
+        else if (ent == "apos") cp = '\'';
+        else if (ent.size() >= 2 && ent[0] == '#')
+        {
+            cp = 0;
+            const bool hex = (ent[1] == 'x' || ent[1] == 'X');
+            for (std::size_t i = hex ? 2 : 1; i < ent.size(); ++i)
+            {
+                const char c = ent[i];
+                int d = -1;
+                if (c >= '0' && c <= '9') d = c - '0';
+                else if (hex && c >= 'a' && c <= 'f') d = c - 'a' + 10;
+                else if (hex && c >= 'A' && c <= 'F') d = c - 'A' + 10;
+                if (d < 0) return false;
+                cp = cp * (hex ? 16 : 10) + (std::uint32_t)d;
+                if (cp > 0x10FFFF) return false;
+            }
+        }
+        else
+        {
+            return false;
+        }
+
+        p = semi + 1;
+        return true;
+    }
+
+    // ƼƼ ؼ +  ȭ (wide / UTF-8  )
+    template <class Str, class AppendRunFn, class AppendCpFn>
+    static void AppendXmlTextImpl(Str& out, std::string_view raw, AppendRunFn appendRun, AppendCpFn appendCp)
+    {
+        const char* p = raw.data();
+        const char* end = p + raw.size();
+        const char* run = p;
+
+        while (p < end)
+        {
+            const char c = *p;
+            if (c != '&' && c != '\r')
+            {
+                ++p;
+                continue;
+            }
+
+            appendRun(out, run, (std::size_t)(p - run));
+
+            std::uint32_t cp = 0;
+            if (c == '\r')
+            {
+                // CRLF / CR  LF
+                out.push_back('\n');
+                ++p;
+                if (p < end && *p == '\n') ++p;
+            }
+            else if (DecodeEntity(p, end, cp))
+            {
+                appendCp(out, cp);
+            }
+            else
+            {
+                out.push_back('&');
+                ++p;
+            }
+            run = p;
+        }
+
+        appendRun(out, run, (std::size_t)(p - run));
+    }
+}
+
+namespace Native
+{
+    void AppendXmlText(std::wstring& out, std::string_view raw)
+    {
+        AppendXmlTextImpl(out, raw, AppendUtf8AsWide, AppendCodePointWide);
+    }
+
+    void AppendXmlText(std::string& out, std::string_view raw)
+    {
+        AppendXmlTextImpl(out, raw, AppendUtf8Sanitized, AppendCodePointUtf8);
+    }
+
+    // =========================
+    // XmlReader
+    // =========================
+    XmlReader::XmlReader(const char* data, std::size_t size)
+        : m_p(data), m_end(data + size)
+    {
+        m_attrs.reserve(16);
+
+        // UTF-8 BOM
+        if (StartsWith(m_p, m_end, "\xEF\xBB\xBF")) m_p += 3;
+    }
+
+    std::string_view XmlReader::LocalName() const
+    {
+        return LocalPart(m_name);
+    }
+
+    bool XmlReader::SkipUntil(std::string_view terminator)
+    {
+        while (m_p < m_end)
+        {
+            if ((std::size_t)(m_end - m_p) >= terminator.size() &&
+                std::memcmp(m_p, terminator.data(), terminator.size()) == 0)
+            {
+                m_p += terminator.size();
+                return true;
+            }
+            ++m_p;
+        }
+        return false;
+    }
+
+    bool XmlReader::ParseStartTag()
+    {
+        // m_p: '<' 
+        const char* nameBegin = m_p;
+        while (m_p < m_end && !IsNameEnd(*m_p)) ++m_p;
+        if (m_p == nameBegin) return false;
+        m_name = std::string_view(nameBegin, (std::size_t)(m_p - nameBegin));
+
+        m_attrs.clear();
+        m_emptyElement = false;
+
+        for (;;)
+        {
+            while (m_p < m_end && IsXmlSpace(*m_p)) ++m_p;
+            if (m_p >= m_end) return false;
+
+            if (*m_p == '>')
+            {
+                ++m_p;
+                return true;
+            }
+            if (*m_p == '/')
+            {
+                if (m_p + 1 >= m_end || m_p[1] != '>') return false;
+                m_p += 2;
+                m_emptyElement = true;
+                return true;
+            }
+
+            // attr name
+            const char* an = m_p;
+            while (m_p < m_end && !IsNameEnd(*m_p)) ++m_p;
+            if (m_p == an) return false;
+            const std::string_view attrName(an, (std::size_t)(m_p - an));
+
+            while (m_p < m_end && IsXmlSpace(*m_p)) ++m_p;
+            if (m_p >= m_end || *m_p != '=') return false;
+            ++m_p;
+            while (m_p < m_end && IsXmlSpace(*m_p)) ++m_p;
+            if (m_p >= m_end || (*m_p != '"' && *m_p != '\'')) return false;
+
+            const char quote = *m_p++;
+            const char* vb = m_p;
+            while (m_p < m_end && *m_p != quote) ++m_p;
+            if (m_p >= m_end) return false;
+
+            m_attrs.push_back({ attrName, std::string_view(vb, (std::size_t)(m_p - vb)) });
+            ++m_p;
+        }
+    }
+
+    XmlEvent XmlReader::Next()
+    {
+        m_cdata = false;
+
+        if (m_pendingEnd)
+        {
+            // <a/>   ° ̺Ʈ
+            m_pendingEnd = false;
+            m_emptyElement = false;
+            m_depth--;
+            return XmlEvent::EndElement;
+        }
+
+        for (;;)
+        {
+            if (m_p >= m_end)
+                return (m_depth == 0) ? XmlEvent::EndOfDocument : XmlEvent::Error;
+
+            if (*m_p != '<')
+            {
+                const char* tb = m_p;
+                const void* lt = std::memchr(m_p, '<', (std::size_t)(m_end - m_p));
+                m_p = lt ? (const char*)lt : m_end;
+                m_text = std::string_view(tb, (std::size_t)(m_p - tb));
+                return XmlEvent::Text;
+            }
+
+            if (StartsWith(m_p, m_end, "<!--"))
+            {
+                m_p += 4;
+                if (!SkipUntil("-->")) return XmlEvent::Error;
+                continue;
+            }
+
+            if (StartsWith(m_p, m_end, "<![CDATA["))
+            {
+                m_p += 9;
+                const char* tb = m_p;
+                if (!SkipUntil("]]>")) return XmlEvent::Error;
+                m_text = std::string_view(tb, (std::size_t)(m_p - 3 - tb));
+                m_cdata = true;
+                return XmlEvent::Text;
+            }
+
+            if (StartsWith(m_p, m_end, "<?"))
+            {
+                m_p += 2;
+                if (!SkipUntil("?>")) return XmlEvent::Error;
+                continue;
+            }
+
+            if (StartsWith(m_p, m_end, "<!"))
+            {
+                m_p += 2;
+                if (!SkipUntil(">")) return XmlEvent::Error;
+                continue;
+            }
+
+            if (StartsWith(m_p, m_end, "</"))
+            {
+                m_p += 2;
+                const char* nb = m_p;
+                while (m_p < m_end && !IsNameEnd(*m_p)) ++m_p;
+                m_name = std::string_view(nb, (std::size_t)(m_p - nb));
+                if (!SkipUntil(">")) return XmlEvent::Error;
+                if (m_depth <= 0) return XmlEvent::Error;
+                m_depth--;
+                return XmlEvent::EndElement;
+            }
+
+            ++m_p;
+            if (!ParseStartTag()) return XmlEvent::Error;
+
+            m_depth++;
+            if (m_emptyElement) m_pendingEnd = true;
+            return XmlEvent::StartElement;
+        }
+    }
+
+    // m_p: '<' ġ. ± ϳ ѱ depth ݿ ( +1,  -1,  /ּ/PI ״)
+    bool XmlReader::SkipMarkup(int& depth)
+    {
+        if (StartsWith(m_p, m_end, "<!--"))
+        {
+            m_p += 4;
+            return SkipUntil("-->");
+        }
+        if (StartsWith(m_p, m_end, "<![CDATA["))
+        {
+            m_p += 9;
+            return SkipUntil("]]>");
+        }
+        if (StartsWith(m_p, m_end, "<?"))
+        {
+            m_p += 2;
+            return SkipUntil("?>");
+        }
+
+        const bool endTag = (m_p + 1 < m_end && m_p[1] == '/');
+
+        // Ӽ  '>' ǳʶ ('<' Ӽ   )
+        char quote = 0;
+        for (++m_p; m_p < m_end; ++m_p)
+        {
+            const char c = *m_p;
+            if (quote)
+            {
+                if (c == quote) quote = 0;
+            }
+            else if (c == '"' || c == '\'')
+            {
+                quote = c;
+            }
+            else if (c == '>')
+            {
+                if (endTag) --depth;
+                else if (m_p[-1] != '/' && m_p[-1] != '!') ++depth;
+                ++m_p;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    bool XmlReader::SkipElement()
+    {
+        if (m_pendingEnd)
+        {
+            // <a/> :  EndElement
+            m_pendingEnd = false;
+            m_emptyElement = false;
+            m_depth--;
+            return true;
+        }
+
+        int depth = 1;
+        while (depth > 0)
+        {
+            const void* lt = std::memchr(m_p, '<', (std::size_t)(m_end - m_p));
+            if (!lt) return false;
+            m_p = (const char*)lt;
+            if (!SkipMarkup(depth)) return false;
+        }
+
+        m_depth--;
+        return true;
+    }
+
+    bool XmlReader::GetAttrRaw(std::string_view localName, std::string_view& raw) const
+    {
+        for (const auto& a : m_attrs)
+        {
+            if (LocalPart(a.name) == localName)
+            {
+                raw = a.value;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    std::uint32_t XmlReader::GetAttrUInt(std::string_view localName, std::uint32_t def) const
+    {
+        std::string_view raw;
+        if (!GetAttrRaw(localName, raw) || raw.empty()) return def;
+
+        std::uint32_t v = 0;
+        for (char c : raw)
+        {
+            if (c < '0' || c > '9') return def;
+            v = v * 10 + (std::uint32_t)(c - '0');
+        }
+        return v;
+    }
+
+    std::wstring XmlReader::GetAttrText(std::string_view localName) const
+    {
+        std::wstring out;
+        std::string_view raw;
+        if (GetAttrRaw(localName, raw))
+            AppendXmlText(out, raw);
+        return out;
+    }
+
+    void XmlReader::AppendText(std::wstring& out) const
+    {
+        if (m_cdata) AppendUtf8AsWide(out, m_text.data(), m_text.size());
+        else AppendXmlText(out, m_text);
+    }
+
+    void XmlReader::AppendText(std::string& out) const
+    {
+        if (m_cdata) AppendUtf8Sanitized(out, m_text.data(), m_text.size());
+        else AppendXmlText(out, m_text);
+    }
+}
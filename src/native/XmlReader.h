@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "native/Utf8.h"
+
+namespace Native
+{
+    enum class XmlEvent : std::uint8_t
+    {
+        StartElement,
+        EndElement,
+        Text,
+        EndOfDocument,
+        Error
+    };
+
+    // ּ pull ļ (HWPX part )
+    // - ӽ̽ ؼ ʰ prefix  local name 
+    // - ּ/PI/DOCTYPE ǳʶ, CDATA Text 
+    // - <a/>  StartElement(IsEmptyElement) + EndElement  ̺Ʈ
+    class XmlReader
+    {
+    public:
+        XmlReader(const char* data, std::size_t size);
+
+        XmlEvent Next();
+
+        //  StartElement ¦ EndElement ° ǳʶ (EndElement ̺Ʈ Һ)
+        // - ̺Ʈ  ʰ '<'  ̸  (̸/Ӽ/ ؼ )
+        // - false:     / Ľ 
+        bool SkipElement();
+
+        //  StartElement/EndElement ̸
+        std::string_view Name() const { return m_name; }
+        std::string_view LocalName() const;
+        bool IsEmptyElement() const { return m_emptyElement; }
+
+        // StartElement:   (Ʈ=1), EndElement:   θ 
+        int Depth() const { return m_depth; }
+
+        //  StartElement Ӽ (local name )
+        bool GetAttrRaw(std::string_view localName, std::string_view& raw) const;
+        std::uint32_t GetAttrUInt(std::string_view localName, std::uint32_t def = 0) const;
+        std::wstring GetAttrText(std::string_view localName) const;
+
+        //  Text ̺Ʈ (ƼƼ ؼ + UTF-8  wide / UTF-8 ״)
+        void AppendText(std::wstring& out) const;
+        void AppendText(std::string& out) const;
+        std::string_view RawText() const { return m_text; }
+        bool IsCData() const { return m_cdata; }
+
+    private:
+        struct Attr
+        {
+            std::string_view name;
+            std::string_view value;
+        };
+
+        bool ParseStartTag();
+        bool SkipUntil(std::string_view terminator);
+        bool SkipMarkup(int& depth);
+
+        const char* m_p;
+        const char* m_end;
+
+        std::string_view m_name;
+        std::string_view m_text;
+        std::vector<Attr> m_attrs;
+
+        int m_depth = 0;
+        bool m_emptyElement = false;
+        bool m_pendingEnd = false;
+        bool m_cdata = false;
+    };
+
+    // ƼƼ(&lt; &#xAC00; ...) ؼ +  ȭ  
+    void AppendXmlText(std::wstring& out, std::string_view raw);
+    void AppendXmlText(std::string& out, std::string_view raw);
+}
@@ -0,0 +1,158 @@
+#include "native/ZipArchive.h"
+#include "native/Inflate.h"
+#include "native/ContentHash.h"
+
+namespace
+{
+    constexpr std::uint32_t SIG_LOCAL_HEADER = 0x04034b50;
+    constexpr std::uint32_t SIG_CENTRAL_DIR = 0x02014b50;
+    constexpr std::uint32_t SIG_END_OF_CENTRAL_DIR = 0x06054b50;
+
+    constexpr std::size_t LOCAL_HEADER_SIZE = 30;
+    constexpr std::size_t CENTRAL_DIR_SIZE = 46;
+    constexpr std::size_t END_OF_CENTRAL_DIR_SIZE = 22;
+
+    static std::uint16_t ReadU16(const std::uint8_t* p)
+    {
+        return (std::uint16_t)(p[0] | (p[1] << 8));
+    }
+
+    static std::uint32_t ReadU32(const std::uint8_t* p)
+    {
+        return (std::uint32_t)p[0]
+            | ((std::uint32_t)p[1] << 8)
+            | ((std::uint32_t)p[2] << 16)
+            | ((std::uint32_t)p[3] << 24);
+    }
+
+    //   EOCD ñ״ó  Ž (ּ ִ 64KB)
+    static const std::uint8_t* FindEndOfCentralDir(const std::uint8_t* data, std::size_t size)
+    {
+        if (size < END_OF_CENTRAL_DIR_SIZE) return nullptr;
+
+        const std::size_t last = size - END_OF_CENTRAL_DIR_SIZE;
+        const std::size_t stop = (last > 0xFFFF) ? last - 0xFFFF : 0;
+
+        for (std::size_t i = last + 1; i-- > stop; )
+        {
+            if (ReadU32(&data[i]) == SIG_END_OF_CENTRAL_DIR)
+                return &data[i];
+        }
+        return nullptr;
+    }
+
+    // ׸    (  nullptr)
+    static const std::uint8_t* EntryData(const Native::ZipArchive& zip, const Native::ZipEntry& entry)
+    {
+        const std::uint8_t* data = zip.file.Data();
+        const std::size_t size = zip.file.Size();
+
+        const std::size_t off = entry.localHeaderOffset;
+        if (off + LOCAL_HEADER_SIZE > size) return nullptr;
+
+        const std::uint8_t* lh = data + off;
+        if (ReadU32(lh) != SIG_LOCAL_HEADER) return nullptr;
+
+        // local header name/extra ̴ central directory ٸ  
+        const std::size_t dataOff = off + LOCAL_HEADER_SIZE + ReadU16(lh + 26) + ReadU16(lh + 28);
+        if (dataOff + entry.compSize > size) return nullptr;
+
+        zip.file.WillRead(dataOff, entry.compSize);
+        return data + dataOff;
+    }
+}
+
+namespace Native
+{
+    bool OpenZip(const std::wstring& path, ZipArchive& zip)
+    {
+        zip.entries.clear();
+
+        if (!zip.file.Open(path)) return false;
+
+        const std::uint8_t* data = zip.file.Data();
+        const std::size_t size = zip.file.Size();
+
+        const std::uint8_t* eocd = FindEndOfCentralDir(data, size);
+        if (!eocd) return false;
+
+        const std::uint16_t entryCount = ReadU16(eocd + 10);
+        const std::uint32_t cdSize = ReadU32(eocd + 12);
+        const std::uint32_t cdOffset = ReadU32(eocd + 16);
+
+        if ((std::size_t)cdOffset + cdSize > size) return false;
+
+        const std::uint8_t* p = data + cdOffset;
+        const std::uint8_t* end = p + cdSize;
+
+        zip.entries.reserve(entryCount);
+        for (std::uint16_t i = 0; i < entryCount; ++i)
+        {
+            if (p + CENTRAL_DIR_SIZE > end) return false;
+            if (ReadU32(p) != SIG_CENTRAL_DIR) return false;
+
+            const std::uint16_t nameLen = ReadU16(p + 28);
+            const std::uint16_t extraLen = ReadU16(p + 30);
+            const std::uint16_t commentLen = ReadU16(p + 32);
+            if (p + CENTRAL_DIR_SIZE + nameLen > end) return false;
+
+            ZipEntry e;
+            e.method = ReadU16(p + 10);
+            e.crc32 = ReadU32(p + 16);
+            e.compSize = ReadU32(p + 20);
+            e.uncompSize = ReadU32(p + 24);
+            e.localHeaderOffset = ReadU32(p + 42);
+            e.name.assign((const char*)p + CENTRAL_DIR_SIZE, nameLen);
+
+            zip.entries.push_back(std::move(e));
+            p += CENTRAL_DIR_SIZE + nameLen + extraLen + commentLen;
+        }
+
+        return true;
+    }
+
+    const ZipEntry* FindZipEntry(const ZipArchive& zip, const std::string& name)
+    {
+        for (const auto& e : zip.entries)
+        {
+            if (e.name == name) return &e;
+        }
+        return nullptr;
+    }
+
+    bool ReadZipEntry(const ZipArchive& zip, const ZipEntry& entry, std::string& out)
+    {
+        out.clear();
+
+        const std::uint8_t* src = EntryData(zip, entry);
+        if (!src) return false;
+
+        switch (entry.method)
+        {
+        case 0:
+            if (entry.compSize != entry.uncompSize) return false;
+            out.assign((const char*)src, entry.compSize);
+            return true;
+
+        case 8:
+            //     ũ  ջ (Ǯ  )
+            if (entry.uncompSize / MAX_DEFLATE_RATIO > entry.compSize) return false;
+            if (!InflateRaw(src, entry.compSize, out, entry.uncompSize)) return false;
+            return out.size() == entry.uncompSize;
+
+        default:
+            return false;
+        }
+    }
+
+    bool HashZipEntry(const ZipArchive& zip, const ZipEntry& entry, std::uint64_t& hash)
+    {
+        const std::uint8_t* src = EntryData(zip, entry);
+        if (!src) return false;
+
+        // Ÿ͸ seed (  Ʈ /ũⰡ ٸ ٸ )
+        const std::uint64_t seed = ((std::uint64_t)entry.crc32 << 32) ^ ((std::uint64_t)entry.uncompSize << 16) ^ entry.method;
+        hash = ContentHash64(src, entry.compSize, seed);
+        return true;
+    }
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "native/MappedFile.h"
+
+namespace Native
+{
+    // central directory  ׸
+    struct ZipEntry
+    {
+        std::string name;                   // : "Contents/section0.xml"
+        std::uint16_t method = 0;           // 0=stored, 8=deflate
+        std::uint32_t crc32 = 0;            //    CRC-32
+        std::uint32_t compSize = 0;
+        std::uint32_t uncompSize = 0;
+        std::uint32_t localHeaderOffset = 0;
+    };
+
+    // .hwpx(zip) Ű ( θ, central directory Ľ)
+    // - ׸ ʹ ReadZipEntry û    
+    //    ̹/̸ ׸ ũ  
+    struct ZipArchive
+    {
+        MappedFile file;
+        std::vector<ZipEntry> entries;
+    };
+
+    //  + central directory Ľ (ZIP64/ȣȭ )
+    bool OpenZip(const std::wstring& path, ZipArchive& zip);
+
+    // ̸ ׸ ã ( nullptr)
+    const ZipEntry* FindZipEntry(const ZipArchive& zip, const std::string& name);
+
+    // ׸ ϳ   (û ׸ inflate)
+    bool ReadZipEntry(const ZipArchive& zip, const ZipEntry& entry, std::string& out);
+
+    // ׸  ؽ (    Ʈ + CRC-32/ũ/)
+    // -  Ʈ  ׸̸   (ٽ  ׸  Ƶ ٸ  )
+    bool HashZipEntry(const ZipArchive& zip, const ZipEntry& entry, std::uint64_t& hash);
+}
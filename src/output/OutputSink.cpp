@@ -0,0 +1,243 @@
+#include "output/OutputSink.h"
+#include "native/WidePath.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <climits>
+#include <cstdio>
+#include <cstring>
+#include <cwchar>
+#include <filesystem>
+
+#ifdef _WIN32
+#include <fcntl.h>
+#include <io.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace Output
+{
+    // =========================
+    // Sink ( )
+    // =========================
+    Sink::Sink(std::size_t bufferBytes)
+        : m_buf(std::max<std::size_t>(bufferBytes, 1))
+    {
+    }
+
+    bool Sink::Drain()
+    {
+        if (m_used == 0) return true;
+
+        const std::size_t n = m_used;
+        m_used = 0;
+        if (!WriteRaw(m_buf.data(), n)) { m_failed = true; return false; }
+        m_written += n;
+        return true;
+    }
+
+    bool Sink::Write(const char* data, std::size_t size)
+    {
+        if (m_failed) return false;
+
+        const std::size_t room = m_buf.size() - m_used;
+        if (size <= room)
+        {
+            std::memcpy(m_buf.data() + m_used, data, size);
+            m_used += size;
+            if (m_used == m_buf.size()) return Drain();
+            return true;
+        }
+
+        // ۸ ä    ũ⿡  / 
+        std::memcpy(m_buf.data() + m_used, data, room);
+        m_used += room;
+        data += room;
+        size -= room;
+        if (!Drain()) return false;
+
+        if (size >= m_buf.size())
+        {
+            if (!WriteRaw(data, size)) { m_failed = true; return false; }
+            m_written += size;
+            return true;
+        }
+
+        std::memcpy(m_buf.data(), data, size);
+        m_used = size;
+        return true;
+    }
+
+    bool Sink::Flush()
+    {
+        if (m_failed) return false;
+        if (!Drain()) return false;
+        if (!SyncRaw()) { m_failed = true; return false; }
+        return true;
+    }
+
+    bool Sink::Finish()
+    {
+        const bool flushed = Flush();
+        const bool closed = CloseRaw();
+        if (!closed) m_failed = true;
+        return flushed && closed;
+    }
+
+    void Sink::Abort()
+    {
+        m_used = 0;
+        m_failed = true;
+        AbortRaw();
+    }
+
+    // =========================
+    // FileSink
+    // =========================
+    FileSink::FileSink(const std::wstring& path)
+        : m_path(path)
+    {
+        // Sink ̹  ۸ Ƿ filebuf ۴  (open  )
+        m_file.rdbuf()->pubsetbuf(nullptr, 0);
+        m_file.open(Native::ToPath(path), std::ios::binary | std::ios::trunc);
+    }
+
+    bool FileSink::WriteRaw(const char* data, std::size_t size)
+    {
+        m_file.write(data, (std::streamsize)size);
+        return (bool)m_file;
+    }
+
+    bool FileSink::SyncRaw()
+    {
+        m_file.flush();
+        return (bool)m_file;
+    }
+
+    bool FileSink::CloseRaw()
+    {
+        if (!m_file.is_open()) return false;
+        m_file.close();
+        return !m_file.fail();
+    }
+
+    void FileSink::AbortRaw()
+    {
+        if (m_file.is_open()) m_file.close();
+
+        //     
+        std::error_code ec;
+        std::filesystem::remove(Native::ToPath(m_path), ec);
+    }
+
+    // =========================
+    // FdSink / StdoutSink
+    // =========================
+    FdSink::FdSink(int fd, bool closeOnFinish)
+        : m_fd(fd), m_closeOnFinish(closeOnFinish)
+    {
+    }
+
+    bool FdSink::WriteRaw(const char* data, std::size_t size)
+    {
+        if (m_fd < 0) return false;
+
+        while (size > 0)
+        {
+#ifdef _WIN32
+            const unsigned int chunk = (unsigned int)std::min<std::size_t>(size, INT_MAX);
+            const int n = _write(m_fd, data, chunk);
+#else
+            const ssize_t n = ::write(m_fd, data, size);
+#endif
+            if (n < 0)
+            {
+                if (errno == EINTR) continue;
+                return false;
+            }
+            data += n;
+            size -= (std::size_t)n;
+        }
+        return true;
+    }
+
+    bool FdSink::CloseRaw()
+    {
+        if (!m_closeOnFinish || m_fd < 0) return true;
+
+#ifdef _WIN32
+        const int rc = _close(m_fd);
+#else
+        const int rc = ::close(m_fd);
+#endif
+        m_fd = -1;
+        return rc == 0;
+    }
+
+    static int PrepareStdout()
+    {
+        // stdio ʿ   HTML ߰  ʰ
+        std::fflush(stdout);
+#ifdef _WIN32
+        // main ֿܼ U16TEXT ɾ ιǷ Ʈ ״  ȯ
+        _setmode(_fileno(stdout), _O_BINARY);
+        return _fileno(stdout);
+#else
+        return STDOUT_FILENO;
+#endif
+    }
+
+    StdoutSink::StdoutSink()
+        : FdSink(PrepareStdout(), false)
+    {
+    }
+
+    bool ParseFdPath(const std::wstring& path, int& fd)
+    {
+        if (path.size() <= 3 || path.compare(0, 3, L"fd:") != 0) return false;
+
+        wchar_t* end = nullptr;
+        const unsigned long v = std::wcstoul(path.c_str() + 3, &end, 10);
+        if (*end != L'\0' || path[3] < L'0' || path[3] > L'9' || v > (unsigned long)INT_MAX) return false;
+
+        fd = (int)v;
+        return true;
+    }
+
+    bool IsStreamPath(const std::wstring& path)
+    {
+        int fd = 0;
+        return path == L"-" || ParseFdPath(path, fd);
+    }
+
+    // Ѱܹ fd  ִ (Windows HTML Ʈ ״  ̳ʸ )
+    static bool PrepareFd(int fd)
+    {
+        std::fflush(stdout);    // fd 1 ѱ  (PrepareStdout  )
+#ifdef _WIN32
+        if (_get_osfhandle(fd) == -1) return false;
+        _setmode(fd, _O_BINARY);
+        return true;
+#else
+        return ::fcntl(fd, F_GETFD) != -1;
+#endif
+    }
+
+    std::unique_ptr<Sink> OpenSink(const std::wstring& path)
+    {
+        if (path == L"-") return std::make_unique<StdoutSink>();
+
+        int fd = 0;
+        if (ParseFdPath(path, fd))
+        {
+            if (!PrepareFd(fd)) return nullptr;
+            return std::make_unique<FdSink>(fd, false);
+        }
+
+        auto file = std::make_unique<FileSink>(path);
+        if (!file->IsOpen()) return nullptr;
+        return file;
+    }
+}
@@ -0,0 +1,107 @@
+#pragma once
+
+#include <cstddef>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Output
+{
+    //   ũ (  ġ )
+    inline constexpr std::size_t BUFFER_BYTES = 64 * 1024;
+
+    // =========================================================
+    //  sink (HTML UTF-8 Ʈ ޴ )
+    // - Write:  ũ ۿ Ҵٰ   ġ 
+    //   (ۺ ū  ۸   ٷ )
+    // - Finish:    + ݱ, Abort:    
+    // -   ϸ  Write/Finish  false
+    // =========================================================
+    class Sink
+    {
+    public:
+        explicit Sink(std::size_t bufferBytes = BUFFER_BYTES);
+        virtual ~Sink() = default;
+
+        Sink(const Sink&) = delete;
+        Sink& operator=(const Sink&) = delete;
+
+        bool Write(const char* data, std::size_t size);
+        bool Write(std::string_view s) { return Write(s.data(), s.size()); }
+
+        bool Flush();           //   ġ ( ʿ ٷ   ְ)
+        bool Finish();          // Flush + ݱ
+        void Abort();           //   + ġ  (: )
+
+        bool Failed() const { return m_failed; }
+        std::size_t BytesWritten() const { return m_written; }
+
+    protected:
+        virtual bool WriteRaw(const char* data, std::size_t size) = 0;
+        virtual bool SyncRaw() { return true; }
+        virtual bool CloseRaw() { return true; }
+        virtual void AbortRaw() {}
+
+    private:
+        bool Drain();
+
+        std::vector<char> m_buf;
+        std::size_t m_used = 0;
+        std::size_t m_written = 0;
+        bool m_failed = false;
+    };
+
+    //  (Abort     )
+    class FileSink : public Sink
+    {
+    public:
+        explicit FileSink(const std::wstring& path);
+        bool IsOpen() const { return m_file.is_open(); }
+
+    protected:
+        bool WriteRaw(const char* data, std::size_t size) override;
+        bool SyncRaw() override;
+        bool CloseRaw() override;
+        void AbortRaw() override;
+
+    private:
+        std::wstring m_path;
+        std::ofstream m_file;
+    };
+
+    //  ũ (/ , κ /EINTR õ)
+    // -   "fd:N" θ μ ѱ fd ٷ  (OpenSink)
+    class FdSink : public Sink
+    {
+    public:
+        explicit FdSink(int fd, bool closeOnFinish = false);
+
+    protected:
+        bool WriteRaw(const char* data, std::size_t size) override;
+        bool CloseRaw() override;
+
+    private:
+        int m_fd;
+        bool m_closeOnFinish;
+    };
+
+    // ǥ  (Windows ̳ʸ  ȯ  ܼ ޽ stderr)
+    class StdoutSink : public FdSink
+    {
+    public:
+        StdoutSink();
+    };
+
+    //   "fd:N" (N: ̹   ũ, 10)
+    bool ParseFdPath(const std::wstring& path, int& fd);
+
+    //  ƴ : "-"(ǥ ) Ǵ "fd:N"
+    //  ϸ /ߺ ȸ/ ĳ   
+    bool IsStreamPath(const std::wstring& path);
+
+    // "-"  StdoutSink, "fd:N"  FdSink( , fd ڴ ȣ ),    FileSink
+    // ( / fd nullptr)
+    std::unique_ptr<Sink> OpenSink(const std::wstring& path);
+}
@@ -0,0 +1,155 @@
+#include "render/ChunkWriter.h"
+
+namespace
+{
+    inline bool NeedsJsonEscape(unsigned char ch)
+    {
+        return ch < 0x20 || ch == '"' || ch == '\\';
+    }
+
+    void AppendJsonEscape(std::string& out, unsigned char ch)
+    {
+        static const char HEX[] = "0123456789abcdef";
+
+        switch (ch)
+        {
+        case '"':  out += "\\\""; return;
+        case '\\': out += "\\\\"; return;
+        case '\n': out += "\\n"; return;
+        case '\r': out += "\\r"; return;
+        case '\t': out += "\\t"; return;
+        case '\b': out += "\\b"; return;
+        case '\f': out += "\\f"; return;
+        default:
+            out += "\\u00";
+            out += HEX[ch >> 4];
+            out += HEX[ch & 0xF];
+            return;
+        }
+    }
+
+    void OpenChunk(Html::ChunkState& chunk, std::string& out)
+    {
+        out += "{\"id\":";
+        out += std::to_string(chunk.nextId++);
+        out += ",\"heading\":[";
+        for (std::size_t i = 0; i < chunk.headings.size(); ++i)
+        {
+            if (i) out += ',';
+            out += '"';
+            out += chunk.headings[i].second;
+            out += '"';
+        }
+        out += "],\"text\":\"";
+        out += chunk.pendingHeads;
+
+        chunk.open = true;
+        chunk.bodyBytes = chunk.pendingHeads.size();
+        chunk.hasTable = false;
+        chunk.hasList = false;
+        chunk.pendingHeads.clear();
+        chunk.pendingLevel = 0;
+    }
+
+    void CloseChunk(Html::ChunkState& chunk, std::string& out)
+    {
+        if (!chunk.open) return;
+
+        out += "\",\"table\":";
+        out += chunk.hasTable ? "true" : "false";
+        out += ",\"list\":";
+        out += chunk.hasList ? "true" : "false";
+        out += "}\n";
+        chunk.open = false;
+    }
+
+    //   :  Ѱ Ǹ ݰ   η  ûũ
+    void BeginBodyBlock(Html::ChunkState& chunk, std::string& out, std::size_t incoming)
+    {
+        if (chunk.open && chunk.bodyBytes > 0 && chunk.bodyBytes + incoming > chunk.budget)
+            CloseChunk(chunk, out);
+        if (!chunk.open) OpenChunk(chunk, out);
+    }
+}
+
+namespace Html {
+
+    void AppendJsonEscaped(std::string& out, const char* s, std::size_t n)
+    {
+        std::size_t start = 0;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            const unsigned char ch = (unsigned char)s[i];
+            if (!NeedsJsonEscape(ch)) continue;
+
+            out.append(s + start, i - start);
+            AppendJsonEscape(out, ch);
+            start = i + 1;
+        }
+        out.append(s + start, n - start);
+    }
+
+    void JsonEscapeTail(std::string& buf, std::size_t from)
+    {
+        std::size_t k = from;
+        while (k < buf.size() && !NeedsJsonEscape((unsigned char)buf[k])) ++k;
+        if (k == buf.size()) return;
+
+        // ù Ư ں ٽ 
+        const std::string tail(buf, k);
+        buf.resize(k);
+        AppendJsonEscaped(buf, tail.data(), tail.size());
+    }
+
+    void AppendChunkParagraph(ChunkState& chunk, std::string& out, std::string_view text, int level, bool listItem)
+    {
+        if (level < 1 || level > 10)
+        {
+            BeginBodyBlock(chunk, out, text.size() + 2);
+            if (listItem) chunk.hasList = true;
+
+            out.append(text.data(), text.size());
+            out += "\\n";
+            chunk.bodyBytes += text.size() + 2;
+            return;
+        }
+
+        // :  ִ ûũ ⼭ 
+        //      /     η  
+        if (chunk.open) CloseChunk(chunk, out);
+        else if (!chunk.pendingHeads.empty() && level <= chunk.pendingLevel)
+        {
+            OpenChunk(chunk, out);
+            CloseChunk(chunk, out);
+        }
+
+        while (!chunk.headings.empty() && chunk.headings.back().first >= level)
+            chunk.headings.pop_back();
+        chunk.headings.emplace_back(level, std::string(text));
+
+        chunk.pendingHeads.append(text.data(), text.size());
+        chunk.pendingHeads += "\\n";
+        chunk.pendingLevel = level;
+    }
+
+    void BeginChunkTable(ChunkState& chunk, std::string& out)
+    {
+        BeginBodyBlock(chunk, out, 0);
+        chunk.hasTable = true;
+        chunk.tableStart = out.size();
+    }
+
+    void EndChunkTable(ChunkState& chunk, const std::string& out)
+    {
+        // ǥ  ߿ drain  (drain ֻ  ̿)
+        if (out.size() > chunk.tableStart) chunk.bodyBytes += out.size() - chunk.tableStart;
+    }
+
+    void FinishChunks(ChunkState& chunk, std::string& out)
+    {
+        //     ٸ  ûũ
+        if (!chunk.open && !chunk.pendingHeads.empty()) OpenChunk(chunk, out);
+        CloseChunk(chunk, out);
+    }
+
+} // namespace Html
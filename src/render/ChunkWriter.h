@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Html {
+
+    // =========================================================
+    // JSONL ûũ  (Ӻ ο,    )
+    // -   = ûũ ϳ: {"id":N,"heading":[...],"text":"...","table":b,"list":b}
+    // - :  (Outline 1..10)  / ũ (budget) ʰ
+    //    /ǥ θ Ȯ (/ǥ ϳ ɰ )
+    // -  ȸϸ鼭 ٷ out  (ûũ °   )
+    //    ÷(table/list) ûũ    
+    // - ڿ  JSON ̽ ·  (paraBuffer/)
+    // =========================================================
+    struct ChunkState
+    {
+        static constexpr std::size_t DEFAULT_BUDGET = 2048;
+
+        bool enabled = false;
+        std::size_t budget = DEFAULT_BUDGET;    // ûũ  Ʈ (UTF-8, ̽ )
+
+        bool open = false;                      // Ӹ({"id"..."text":") ̹ 
+        std::uint64_t nextId = 0;
+        std::size_t bodyBytes = 0;
+        bool hasTable = false;
+        bool hasList = false;
+        std::size_t tableStart = 0;             // ֻ ǥ   out ġ
+
+        //    (, ̽ )
+        std::vector<std::pair<int, std::string>> headings;
+
+        //      (   ûũ տ,   ̸ ̾ )
+        //   ִ ûũ   ʰ, Ӹ  ΰ   
+        std::string pendingHeads;
+        int pendingLevel = 0;
+    };
+
+    // JSON ڿ ̽ (" \  ), UTF-8 ״
+    void AppendJsonEscaped(std::string& out, const char* s, std::size_t n);
+
+    inline void AppendJsonEscaped(std::string& out, std::string_view s)
+    {
+        AppendJsonEscaped(out, s.data(), s.size());
+    }
+
+    // buf[from..] ڸ ̽
+    void JsonEscapeTail(std::string& buf, std::size_t from);
+
+    //  ϳ (level:   1..10, ƴϸ 0)
+    void AppendChunkParagraph(ChunkState& chunk, std::string& out, std::string_view text, int level, bool listItem);
+
+    // ֻ ǥ / (ǥ  TableRenderer out ٷ )
+    void BeginChunkTable(ChunkState& chunk, std::string& out);
+    void EndChunkTable(ChunkState& chunk, const std::string& out);
+
+    //  :  ûũ ݱ
+    void FinishChunks(ChunkState& chunk, std::string& out);
+
+} // namespace Html
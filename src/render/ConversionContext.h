@@ -0,0 +1,32 @@
+#pragma once
+
+// =========================================================
+// ȯ 1 
+// - ϵ (Ÿ/Ʈ ε + Ÿ ±) +  (/Ʈ/) + Ŀ 
+// - ȯ ϳ  Ŀ/ ѱ
+//     μ ȿ ȯ N  N ÿ   
+// =========================================================
+
+#include <memory>
+
+#include "sdk/SDK_Wrapper.h"
+#include "render/HtmlRenderer.h"
+#include "render/StyleTable.h"
+#include "walker/ElementHandlers.h"
+#include "walker/WalkStats.h"
+
+// (header.xml)  ε 
+// -   ڿ б     Ŀ/ ø ٸ (HeadCache) ״ 
+struct CompiledHead
+{
+    SDK::HeadIndex index;
+    Html::StyleTable styles;    // index.styleMap 
+};
+
+struct ConversionContext
+{
+    std::shared_ptr<const CompiledHead> head = std::make_shared<CompiledHead>();
+    Html::RenderState html;
+    ElementHandlers::PruneOptions prune;
+    WalkStats walk;
+};
@@ -0,0 +1,169 @@
+#include "render/HtmlEscape.h"
+
+#if defined(_M_X64) || defined(__x86_64__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2) || (defined(__i386__) && defined(__SSE2__))
+#define HWPX_ESCAPE_X86 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#else
+#define HWPX_ESCAPE_X86 0
+#endif
+
+namespace
+{
+    // '<'(0x3C) '>'(0x3E)  x|2 == '>',  '"'(0x22) '&'(0x26)  x|4 == '&'
+    // (    ڸ Ѳ)
+    inline bool IsEscapeChar(unsigned char ch)
+    {
+        return (ch | 2) == '>' || (ch | 4) == '&';
+    }
+
+    const char* EntityFor(char ch, std::size_t& len)
+    {
+        switch (ch)
+        {
+        case '<': len = 4; return "&lt;";
+        case '>': len = 4; return "&gt;";
+        case '&': len = 5; return "&amp;";
+        default:  len = 6; return "&quot;";
+        }
+    }
+
+    std::size_t FindEscapeScalar(const char* s, std::size_t n)
+    {
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            if (IsEscapeChar((unsigned char)s[i])) return i;
+        }
+        return n;
+    }
+
+#if HWPX_ESCAPE_X86
+    inline unsigned int LowestBit(unsigned int mask)
+    {
+#if defined(_MSC_VER)
+        unsigned long index = 0;
+        _BitScanForward(&index, mask);
+        return (unsigned int)index;
+#else
+        return (unsigned int)__builtin_ctz(mask);
+#endif
+    }
+
+    std::size_t FindEscapeSse2(const char* s, std::size_t n)
+    {
+        const __m128i or2 = _mm_set1_epi8(2);
+        const __m128i or4 = _mm_set1_epi8(4);
+        const __m128i gt = _mm_set1_epi8('>');
+        const __m128i amp = _mm_set1_epi8('&');
+
+        std::size_t i = 0;
+        for (; i + 16 <= n; i += 16)
+        {
+            const __m128i v = _mm_loadu_si128((const __m128i*)(s + i));
+            const __m128i hit = _mm_or_si128(
+                _mm_cmpeq_epi8(_mm_or_si128(v, or2), gt),
+                _mm_cmpeq_epi8(_mm_or_si128(v, or4), amp));
+
+            const unsigned int mask = (unsigned int)_mm_movemask_epi8(hit);
+            if (mask) return i + LowestBit(mask);
+        }
+        return i + FindEscapeScalar(s + i, n - i);
+    }
+
+#if defined(__GNUC__) && !defined(__AVX2__)
+    __attribute__((target("avx2")))
+#endif
+    std::size_t FindEscapeAvx2(const char* s, std::size_t n)
+    {
+        const __m256i or2 = _mm256_set1_epi8(2);
+        const __m256i or4 = _mm256_set1_epi8(4);
+        const __m256i gt = _mm256_set1_epi8('>');
+        const __m256i amp = _mm256_set1_epi8('&');
+
+        std::size_t i = 0;
+        for (; i + 32 <= n; i += 32)
+        {
+            const __m256i v = _mm256_loadu_si256((const __m256i*)(s + i));
+            const __m256i hit = _mm256_or_si256(
+                _mm256_cmpeq_epi8(_mm256_or_si256(v, or2), gt),
+                _mm256_cmpeq_epi8(_mm256_or_si256(v, or4), amp));
+
+            const unsigned int mask = (unsigned int)_mm256_movemask_epi8(hit);
+            if (mask) return i + LowestBit(mask);
+        }
+        return i + FindEscapeSse2(s + i, n - i);
+    }
+
+    bool CpuHasAvx2()
+    {
+#if defined(_MSC_VER)
+        int info[4] = {};
+        __cpuid(info, 0);
+        if (info[0] < 7) return false;
+
+        // OS YMM ͸  ִ (OSXSAVE + XCR0)
+        __cpuid(info, 1);
+        const bool osxsave = (info[2] & (1 << 27)) != 0;
+        const bool avx = (info[2] & (1 << 28)) != 0;
+        if (!osxsave || !avx) return false;
+        if ((_xgetbv(0) & 0x6) != 0x6) return false;
+
+        __cpuidex(info, 7, 0);
+        return (info[1] & (1 << 5)) != 0;
+#else
+        return __builtin_cpu_supports("avx2") != 0;
+#endif
+    }
+
+    using FindFn = std::size_t(*)(const char*, std::size_t);
+
+    FindFn SelectFind()
+    {
+        return CpuHasAvx2() ? FindEscapeAvx2 : FindEscapeSse2;
+    }
+#endif
+}
+
+namespace Html
+{
+    std::size_t FindEscapeChar(const char* s, std::size_t n)
+    {
+#if HWPX_ESCAPE_X86
+        static const FindFn find = SelectFind();
+        return find(s, n);
+#else
+        return FindEscapeScalar(s, n);
+#endif
+    }
+
+    void AppendEscaped(std::string& out, const char* s, std::size_t n)
+    {
+        std::size_t start = 0;
+        while (start < n)
+        {
+            const std::size_t k = start + FindEscapeChar(s + start, n - start);
+            out.append(s + start, k - start);
+            if (k == n) break;
+
+            std::size_t len = 0;
+            const char* entity = EntityFor(s[k], len);
+            out.append(entity, len);
+            start = k + 1;
+        }
+    }
+
+    void EscapeTail(std::string& buf, std::size_t from)
+    {
+        if (from >= buf.size()) return;
+
+        const std::size_t k = from + FindEscapeChar(buf.data() + from, buf.size() - from);
+        if (k == buf.size()) return;
+
+        // ù Ư ں ٽ 
+        const std::string tail(buf, k);
+        buf.resize(k);
+        AppendEscaped(buf, tail.data(), tail.size());
+    }
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace Html
+{
+    // =========================================================
+    // HTML ̽ (ؽƮ/Ӽ )
+    // - < > & "  &lt; &gt; &amp; &quot;
+    // - UTF-8 ״ ó:  ڴ  ASCII ƼƮ (ѱ ) ǵ帮 
+    // - Ư  ġ AVX2/SSE2 ã(Ÿ ),     ° 
+    //   x86 ƴϸ Į
+    // =========================================================
+
+    // ù Ư  ġ ( n)
+    std::size_t FindEscapeChar(const char* s, std::size_t n);
+
+    void AppendEscaped(std::string& out, const char* s, std::size_t n);
+
+    inline void AppendEscaped(std::string& out, std::string_view s)
+    {
+        AppendEscaped(out, s.data(), s.size());
+    }
+
+    // buf[from..] ڸ ̽ (Ư ڰ   )
+    void EscapeTail(std::string& buf, std::size_t from);
+}
@@ -1,380 +1,434 @@
 #include "render/HtmlRenderer.h"
+#include "render/ConversionContext.h"
+#include "render/HtmlEscape.h"
 
 #include <cwctype>
 #include <map>
 #include <iostream>
 
 #include "sdk/SDK_Wrapper.h"
+#include "sdk/SdkConfig.h"
+#include "native/Utf8.h"
+#if HWPX_USE_OWPML_SDK
 #include "sdk/OwpmSDKPrelude.h"
+#endif
 
 namespace Html {
 
     // ===========================
     // Cell mode + LineBreak policy
     // ===========================
-    static bool& CellMode()
+    void SetCellMode(ConversionContext& ctx, bool on)
     {
-        static bool cellMode = false;
-        return cellMode;
+        ctx.html.cellMode = on;
+        if (on) ctx.html.cellHasWrittenText = false;
     }
 
-    static CellBreakMode& CellBreakPolicy()
+    bool IsCellMode(const ConversionContext& ctx)
     {
-        static CellBreakMode mode = CellBreakMode::BrTag;
-        return mode;
+        return ctx.html.cellMode;
     }
 
-    static CellBreakMode& CellParagraphPolicy()
+    void SetCellBreakMode(ConversionContext& ctx, CellBreakMode mode)
     {
-        static CellBreakMode mode = CellBreakMode::BrTag;
-        return mode;
+        ctx.html.cellBreakPolicy = mode;
     }
 
-    static bool& CellHasWrittenText()
+    void SetCellParagraphMode(ConversionContext& ctx, CellBreakMode mode)
     {
-        static bool written = false;
-        return written;
+        ctx.html.cellParagraphPolicy = mode;
     }
 
-    void SetCellMode(bool on)
+    void SetTextMode(ConversionContext& ctx, bool on)
     {
-        CellMode() = on;
-        if (on) CellHasWrittenText() = false;
+        ctx.html.textMode = on;
     }
 
-    bool IsCellMode()
+    bool IsTextMode(const ConversionContext& ctx)
     {
-        return CellMode();
+        return ctx.html.textMode;
     }
 
-    void SetCellBreakMode(CellBreakMode mode)
+    void SetTextSeparators(ConversionContext& ctx, const std::string& cellSeparator, const std::string& rowSeparator)
     {
-        CellBreakPolicy() = mode;
+        ctx.html.textCellSeparator = cellSeparator;
+        ctx.html.textRowSeparator = rowSeparator;
     }
 
-    void SetCellParagraphMode(CellBreakMode mode)
+    void SetChunkMode(ConversionContext& ctx, std::size_t budget)
     {
-        CellParagraphPolicy() = mode;
+        RenderState& st = ctx.html;
+
+        st.textMode = true;
+        st.chunk.enabled = true;
+        st.chunk.budget = budget;
+
+        std::string cell, row;
+        AppendJsonEscaped(cell, st.textCellSeparator);
+        AppendJsonEscaped(row, st.textRowSeparator);
+        st.textCellSeparator = std::move(cell);
+        st.textRowSeparator = std::move(row);
+    }
+
+    bool IsChunkMode(const ConversionContext& ctx)
+    {
+        return ctx.html.chunk.enabled;
+    }
+
+    void FinishChunks(ConversionContext& ctx, std::string& out)
+    {
+        if (ctx.html.chunk.enabled) FinishChunks(ctx.html.chunk, out);
+    }
+
+    void BeginTextTable(ConversionContext& ctx, std::string& out)
+    {
+        const RenderState& st = ctx.html;
+        if (st.chunk.enabled && !st.cellMode) BeginChunkTable(ctx.html.chunk, out);
+    }
+
+    void EndTextTable(ConversionContext& ctx, const std::string& out)
+    {
+        const RenderState& st = ctx.html;
+        if (st.chunk.enabled && !st.cellMode) EndChunkTable(ctx.html.chunk, out);
+    }
+
+    void BeginCellContent(ConversionContext& ctx)
+    {
+        ctx.html.cellHasVisibleContent = false;
+    }
+
+    void MarkCellVisibleContent(ConversionContext& ctx)
+    {
+        ctx.html.cellHasVisibleContent = true;
+    }
+
+    bool CellHasVisibleContent(const ConversionContext& ctx)
+    {
+        return ctx.html.cellHasVisibleContent;
     }
 
     // ===========================
     // Helpers
     // ===========================
-    static void AppendBreak(std::wstring& buf, CellBreakMode mode)
+    //  ٹٲ (JSONL̸ ڿ ̶ ̽ )
+    static const char* TextNewline(const RenderState& st)
+    {
+        return st.chunk.enabled ? "\\n" : "\n";
+    }
+
+    static void AppendBreak(const RenderState& st, std::string& buf, CellBreakMode mode)
     {
         switch (mode)
         {
         case CellBreakMode::Space:
-            buf += L" ";
+            buf += " ";
             break;
         case CellBreakMode::Newline:
-            buf += L"\n";
+            buf += TextNewline(st);
             break;
         case CellBreakMode::BrTag:
         default:
-            buf += L"<br/>";
+            buf += st.textMode ? TextNewline(st) : "<br/>";
             break;
         }
     }
 
-    static bool HasMeaningfulText(const std::wstring& s)
+    static bool HasMeaningfulText(const std::string& s)
     {
-        for (wchar_t ch : s)
-        {
-            if (!iswspace(ch)) return true;
-        }
-        return false;
+        return Native::Utf8HasNonSpace(s);
     }
 
-    // ===========================
-    // Outline style mapping
-    // ===========================
-    static int ExtractOutlineLevel(const std::wstring& engName)
+    //   : ASCII   ٸ ڰ ִ
+    template <class CharT>
+    static bool HasVisibleChar(const CharT* s, size_t n)
     {
-        const std::wstring prefix = L"Outline ";
-        if (engName.rfind(prefix, 0) != 0) return 0;
-
-        int level = 0;
-        for (size_t i = prefix.size(); i < engName.size(); ++i)
+        for (size_t i = 0; i < n; ++i)
         {
-            if (!iswdigit(engName[i])) break;
-            level = level * 10 + (engName[i] - L'0');
+            const CharT ch = s[i];
+            if (ch != ' ' && ch != '\t' && ch != '\r' && ch != '\n') return true;
         }
-        return level;
-    }
-
-    static std::wstring MapEngNameToTag(const std::wstring& engName)
-    {
-        const int level = ExtractOutlineLevel(engName);
-        if (level >= 1 && level <= 6)
-            return L"h" + std::to_wstring(level);
-
-        return L"p";
+        return false;
     }
 
-    static std::wstring NormalizeClassName(const std::wstring& engName)
+    //  迡  high surrogate  (ٹٲ/ /UTF-8 ؽƮ )
+    static void FlushPendingSurrogate(RenderState& st)
     {
-        const int level = ExtractOutlineLevel(engName);
-        if (level >= 1 && level <= 10)
-            return L"outline-" + std::to_wstring(level);
-
-        return engName;
+        Native::FinishWideAsUtf8(st.paraBuffer, st.pendingHigh);
     }
 
     // ===========================
     // Style log (optional)
     // ===========================
-    static std::map<std::wstring, int>& StyleSeenAll()
+    static void LogParaStyle(ConversionContext& ctx, std::uint32_t slot)
     {
-        static std::map<std::wstring, int> m;
-        return m;
+        std::vector<std::uint32_t>& counts = ctx.html.styleUseCount;
+        if (slot >= counts.size()) counts.resize(ctx.head->styles.SlotCount(), 0);
+        ++counts[slot];
     }
 
-    static std::map<std::wstring, int>& StyleSeenMapped()
+    void DumpStyleLogToConsole(const ConversionContext& ctx)
     {
-        static std::map<std::wstring, int> m;
-        return m;
-    }
-
-    static std::map<std::wstring, int>& StyleSeenUnmapped()
-    {
-        static std::map<std::wstring, int> m;
-        return m;
-    }
+        //   ̸  ( engName  ID   )
+        std::map<std::wstring, int> seenAll;
+        std::map<std::wstring, int> seenMapped;
+        std::map<std::wstring, int> seenUnmapped;
 
-    static bool IsMappedEngName(const std::wstring& engName)
-    {
-        if (engName.rfind(L"Outline ", 0) == 0) return true;
-        if (engName == L"Normal") return true;
-        if (engName == L"Body") return true;
-        return false;
-    }
+        const std::vector<std::uint32_t>& counts = ctx.html.styleUseCount;
+        for (std::size_t slot = 0; slot < counts.size(); ++slot)
+        {
+            if (counts[slot] == 0) continue;
 
-    static void LogParaStyle(const std::wstring& engName)
-    {
-        StyleSeenAll()[engName]++;
-        if (IsMappedEngName(engName))
-            StyleSeenMapped()[engName]++;
-        else
-            StyleSeenUnmapped()[engName]++;
-    }
+            const StyleTag& tag = ctx.head->styles.At((std::uint32_t)slot);
+            seenAll[tag.engName] += (int)counts[slot];
+            if (tag.mapped) seenMapped[tag.engName] += (int)counts[slot];
+            else seenUnmapped[tag.engName] += (int)counts[slot];
+        }
 
-    void DumpStyleLogToConsole()
-    {
         std::wcout << L"\n================== STYLE LOG SUMMARY ==================\n";
-        std::wcout << L"[ALL] count=" << StyleSeenAll().size() << L"\n";
-        std::wcout << L"[MAPPED] count=" << StyleSeenMapped().size() << L"\n";
-        std::wcout << L"[UNMAPPED] count=" << StyleSeenUnmapped().size() << L"\n\n";
+        std::wcout << L"[ALL] count=" << seenAll.size() << L"\n";
+        std::wcout << L"[MAPPED] count=" << seenMapped.size() << L"\n";
+        std::wcout << L"[UNMAPPED] count=" << seenUnmapped.size() << L"\n\n";
 
         std::wcout << L"------------------ UNMAPPED STYLES ------------------\n";
-        for (auto& kv : StyleSeenUnmapped())
+        for (auto& kv : seenUnmapped)
             std::wcout << L"- " << kv.first << L" : " << kv.second << L"\n";
 
         std::wcout << L"======================================================\n";
     }
 
-    // ===========================
-    // Paragraph state
-    // ===========================
-    static bool& InPara()
-    {
-        static bool inPara = false;
-        return inPara;
-    }
-
-    static std::wstring& ParaTag()
-    {
-        static std::wstring tag;
-        return tag;
-    }
-
-    static std::wstring& ParaClass()
+    void MergeStyleLog(ConversionContext& into, const ConversionContext& from)
     {
-        static std::wstring cls;
-        return cls;
-    }
-
-    static std::wstring& ParaBuffer()
-    {
-        static std::wstring buf;
-        return buf;
+        //  忡  Ÿ ̺   ȣ 
+        std::vector<std::uint32_t>& dst = into.html.styleUseCount;
+        const std::vector<std::uint32_t>& src = from.html.styleUseCount;
+        if (dst.size() < src.size()) dst.resize(src.size(), 0);
+        for (std::size_t slot = 0; slot < src.size(); ++slot) dst[slot] += src[slot];
     }
 
     // ===========================
     // List state machine
     // ===========================
-    static bool& InList()
-    {
-        static bool inList = false;
-        return inList;
-    }
-
-    static SDK::ListKind& CurListKind()
+    void EnsureListOpen(ConversionContext& ctx, std::string& out, const SDK::ListInfo& info)
     {
-        static SDK::ListKind k = SDK::ListKind::None;
-        return k;
-    }
+        RenderState& st = ctx.html;
 
-    static std::uint32_t& CurListIdRef()
-    {
-        static std::uint32_t v = 0;
-        return v;
-    }
-
-    static bool& ParaIsListItem()
-    {
-        static bool v = false;
-        return v;
-    }
-
-    void EnsureListOpen(std::wstring& out, const SDK::ListInfo& info)
-    {
-        if (IsCellMode()) return;                 // ̺  ϴ 
+        if (st.cellMode) return;                 // ̺  ϴ 
         if (info.kind == SDK::ListKind::None) return;
         if (info.idRef == 0) return;              //  ٽ: idRef==0̸  
 
         // ٸ Ʈ ٲ ݰ ٽ 
-        if (InList())
+        if (st.inList)
         {
-            if (CurListKind() != info.kind || CurListIdRef() != info.idRef)
+            if (st.curListKind != info.kind || st.curListIdRef != info.idRef)
             {
-                out += L"</ol>\n";
-                InList() = false;
-                CurListKind() = SDK::ListKind::None;
-                CurListIdRef() = 0;
+                out += "</ol>\n";
+                st.inList = false;
+                st.curListKind = SDK::ListKind::None;
+                st.curListIdRef = 0;
             }
         }
 
-        if (!InList())
+        if (!st.inList)
         {
             // å: numbering/bullet  olθ  CSS  ó
-            out += L"<ol class=\"hwpx-ol-dot\">\n";
-            InList() = true;
-            CurListKind() = info.kind;
-            CurListIdRef() = info.idRef;
+            out += "<ol class=\"hwpx-ol-dot\">\n";
+            st.inList = true;
+            st.curListKind = info.kind;
+            st.curListIdRef = info.idRef;
         }
     }
 
-    void FlushList(std::wstring& out)
+    void FlushList(ConversionContext& ctx, std::string& out)
     {
-        if (!InList()) return;
-        out += L"</ol>\n";
-        InList() = false;
-        CurListKind() = SDK::ListKind::None;
-        CurListIdRef() = 0;
+        RenderState& st = ctx.html;
+
+        if (!st.inList) return;
+        out += "</ol>\n";
+        st.inList = false;
+        st.curListKind = SDK::ListKind::None;
+        st.curListIdRef = 0;
     }
 
-    void BeginListItemMode(const SDK::ListInfo& info)
+    void BeginListItemMode(ConversionContext& ctx, const SDK::ListInfo& info)
     {
-        if (IsCellMode()) { ParaIsListItem() = false; return; }
-        if (info.kind == SDK::ListKind::None) { ParaIsListItem() = false; return; }
-        if (info.idRef == 0) { ParaIsListItem() = false; return; } //  ٽ
-        ParaIsListItem() = true;
+        RenderState& st = ctx.html;
+
+        if (st.cellMode) { st.paraIsListItem = false; return; }
+        if (info.kind == SDK::ListKind::None) { st.paraIsListItem = false; return; }
+        if (info.idRef == 0) { st.paraIsListItem = false; return; } //  ٽ
+        st.paraIsListItem = true;
     }
 
     // ===========================
     // Paragraph lifecycle
     // ===========================
-    void BeginParagraph(OWPML::CPType* para)
+#if HWPX_USE_OWPML_SDK
+    void BeginParagraph(ConversionContext& ctx, OWPML::CPType* para)
     {
         if (!para) return;
-
-        const unsigned int styleID = SDK::GetParaStyleID(para);
-        const std::wstring engName = SDK::GetStyleEngName(styleID);
-
-        LogParaStyle(engName);
-
-        ParaTag() = MapEngNameToTag(engName);
-        ParaClass() = NormalizeClassName(engName);
-
-        InPara() = true;
-        ParaBuffer().clear();
+        BeginParagraphWithStyle(ctx, SDK::GetParaStyleID(para));
     }
 
-    void ProcessText(OWPML::CT* text)
+    void ProcessText(ConversionContext& ctx, OWPML::CT* text)
     {
-        if (!text || !InPara()) return;
+        if (!text || !ctx.html.inPara) return;
+
+        // CChar õ    (GetChildByIndex Ź Ʈ ó )
+        SDK::ChildView& children = ctx.html.textChildren;
+        SDK::BuildChildView(text, children);
 
-        const int count = SDK::GetChildCount(text);
+        const int count = children.Count();
         for (int i = 0; i < count; ++i)
         {
-            OWPML::CObject* child = SDK::GetChildByIndex(text, i);
+            OWPML::CObject* child = children.At(i);
             if (!child) continue;
 
             const unsigned int childID = SDK::GetID(child);
 
             if (childID == ID_PARA_Char)
             {
-                ParaBuffer() += SDK::GetCharValue((OWPML::CChar*)child);
+                AppendText(ctx, SDK::GetCharValue((OWPML::CChar*)child));
             }
             else if (childID == ID_PARA_LineBreak)
             {
-                if (!IsCellMode())
-                {
-                    ParaBuffer() += L"<br/>";
-                }
-                else
-                {
-                    AppendBreak(ParaBuffer(), CellBreakPolicy());
-                }
+                AppendLineBreak(ctx);
             }
         }
     }
+#endif
 
-    void ProcessLineSeg()
+    void BeginParagraphWithStyle(ConversionContext& ctx, unsigned int styleID)
     {
-        if (!InPara()) return;
+        RenderState& st = ctx.html;
+
+        //  ±װ Ƿ Ÿ   (JSONL ûũ  ظ)
+        if (!st.textMode)
+        {
+            st.paraStyleSlot = ctx.head->styles.SlotOf(styleID);
+            LogParaStyle(ctx, st.paraStyleSlot);
+        }
+        else if (st.chunk.enabled)
+        {
+            st.paraStyleSlot = ctx.head->styles.SlotOf(styleID);
+        }
+
+        st.inPara = true;
+        st.paraBuffer.clear();
+        st.pendingHigh = 0;
+        st.paraHasVisibleText = false;
+    }
+
+    void AppendText(ConversionContext& ctx, const std::wstring& text)
+    {
+        RenderState& st = ctx.html;
+
+        if (!st.inPara) return;
+        if (!st.paraHasVisibleText) st.paraHasVisibleText = HasVisibleChar(text.data(), text.size());
+
+        // UTF-8      ̽ (Ư ڰ  ״)
+        const size_t from = st.paraBuffer.size();
+        Native::AppendWideAsUtf8(st.paraBuffer, text.data(), text.size(), st.pendingHigh);
+        if (st.chunk.enabled) JsonEscapeTail(st.paraBuffer, from);
+        else if (!st.textMode) EscapeTail(st.paraBuffer, from);
     }
 
-    void EndParagraph(std::wstring& out)
+    void AppendTextUtf8(ConversionContext& ctx, std::string_view text)
     {
-        if (!InPara()) return;
+        RenderState& st = ctx.html;
 
-        const bool hasText = HasMeaningfulText(ParaBuffer());
+        if (!st.inPara) return;
+        FlushPendingSurrogate(st);
+        if (!st.paraHasVisibleText) st.paraHasVisibleText = HasVisibleChar(text.data(), text.size());
+        if (st.chunk.enabled) AppendJsonEscaped(st.paraBuffer, text);
+        else if (st.textMode) st.paraBuffer.append(text.data(), text.size());
+        else AppendEscaped(st.paraBuffer, text);
+    }
+
+    void AppendLineBreak(ConversionContext& ctx)
+    {
+        RenderState& st = ctx.html;
+
+        if (!st.inPara) return;
+        FlushPendingSurrogate(st);
+
+        if (!st.cellMode)
+        {
+            st.paraBuffer += st.textMode ? TextNewline(st) : "<br/>";
+        }
+        else
+        {
+            AppendBreak(st, st.paraBuffer, st.cellBreakPolicy);
+        }
+    }
+
+    void ProcessLineSeg(ConversionContext& ctx)
+    {
+        if (!ctx.html.inPara) return;
+    }
+
+    void EndParagraph(ConversionContext& ctx, std::string& out)
+    {
+        RenderState& st = ctx.html;
+
+        if (!st.inPara) return;
+        FlushPendingSurrogate(st);
+
+        const bool hasText = HasMeaningfulText(st.paraBuffer);
 
         if (hasText)
         {
-            if (IsCellMode())
+            if (st.cellMode)
             {
-                if (CellHasWrittenText())
+                if (st.cellHasWrittenText)
                 {
-                    std::wstring sep;
-                    AppendBreak(sep, CellParagraphPolicy());
-                    out += sep;
+                    AppendBreak(st, out, st.cellParagraphPolicy);
                 }
-                out += ParaBuffer();
-                CellHasWrittenText() = true;
+                out += st.paraBuffer;
+                st.cellHasWrittenText = true;
+                if (st.paraHasVisibleText) st.cellHasVisibleContent = true;
+            }
+            else if (st.chunk.enabled)
+            {
+                // Ʈ ׸    (HTML li)
+                const int level = st.paraIsListItem ? 0 : ctx.head->styles.At(st.paraStyleSlot).outlineLevel;
+                AppendChunkParagraph(st.chunk, out, st.paraBuffer, level, st.paraIsListItem);
+            }
+            else if (st.textMode)
+            {
+                out += st.paraBuffer;
+                out += "\n";
             }
             else
             {
                 //  Ʈ ̸ liθ 
-                if (ParaIsListItem())
+                if (st.paraIsListItem)
                 {
-                    out += L"<li>";
-                    out += ParaBuffer();
-                    out += L"</li>\n";
+                    out += "<li>";
+                    out += st.paraBuffer;
+                    out += "</li>\n";
                 }
                 else
                 {
-                    out += L"<" + ParaTag() + L" class=\"" + ParaClass() + L"\">";
-                    out += ParaBuffer();
-                    out += L"</" + ParaTag() + L">\n";
+                    const StyleTag& tag = ctx.head->styles.At(st.paraStyleSlot);
+                    out += tag.open;
+                    out += st.paraBuffer;
+                    out += tag.close;
                 }
             }
         }
         //   ̸ ƹ ͵   ( li )
 
-        InPara() = false;
-        ParaIsListItem() = false;
+        st.inPara = false;
+        st.paraIsListItem = false;
+        st.paraHasVisibleText = false;
 
-        ParaTag().clear();
-        ParaClass().clear();
-        ParaBuffer().clear();
+        st.paraStyleSlot = 0;
+        st.paraBuffer.clear();
     }
 
-    void BeginHtmlDocument(std::wstring& out)
+    void BeginHtmlDocument(std::string& out)
     {
-        out += LR"(<!doctype html>
+        out += u8R"(<!doctype html>
 <html>
 <head>
 <meta charset="utf-8"/>
@@ -405,9 +459,9 @@ th, td {
 )";
     }
 
-    void EndHtmlDocument(std::wstring& out)
+    void EndHtmlDocument(std::string& out)
     {
-        out += LR"(
+        out += R"(
 </body>
 </html>
 )";
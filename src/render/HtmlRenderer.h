@@ -1,17 +1,19 @@
 #pragma once
 
 #include <string>
+#include <string_view>
 #include <cstdint>
+#include <vector>
+
+#include "sdk/SDK_Wrapper.h"
+#include "render/ChunkWriter.h"
 
 namespace OWPML {
     class CPType;
     class CT;
 }
 
-namespace SDK {
-    struct ListInfo;
-    enum class ListKind : std::uint8_t;
-}
+struct ConversionContext;
 
 namespace Html {
 
@@ -25,30 +27,98 @@ namespace Html {
         BrTag
     };
 
-    void SetCellMode(bool on);
-    bool IsCellMode();
+    // ===========================
+    // Render state (ȯ 1 , ConversionContext )
+    // ===========================
+    struct RenderState
+    {
+        // output
+        // - textMode: ±/̽/Ÿ/Ʈ  ڸ (RAG  )
+        //   ǥ  / ڷ ħ,   ٹٲ/ cellBreakPolicy/cellParagraphPolicy
+        bool textMode = false;
+        std::string textCellSeparator = "\t";
+        std::string textRowSeparator = "\n";
+        ChunkState chunk;           // enabled  JSON ̽ؼ JSONL ûũ (textMode )
+
+        // cell
+        bool cellMode = false;
+        CellBreakMode cellBreakPolicy = CellBreakMode::BrTag;
+        CellBreakMode cellParagraphPolicy = CellBreakMode::BrTag;
+        bool cellHasWrittenText = false;
+        bool cellHasVisibleContent = false;     // /ٹٲ  ̴  (data-hwpx-empty )
+
+        // paragraph
+        // -  UTF-8 Ʈ ٷ  (   wide  UTF-8 纯ȯ )
+        // - ±/Ŭ ctx.head->styles  (ܸ ڿ  )
+        bool inPara = false;
+        std::uint32_t paraStyleSlot = 0;
+        std::string paraBuffer;
+        std::uint32_t pendingHigh = 0;      // SDK   迡 ɸ high surrogate
+        bool paraHasVisibleText = false;
+        SDK::ChildView textChildren;        // ProcessText ( )
+
+        // list
+        bool inList = false;
+        SDK::ListKind curListKind = SDK::ListKind::None;
+        std::uint32_t curListIdRef = 0;
+        bool paraIsListItem = false;
+
+        // style log (Ժ  , ̸   )
+        std::vector<std::uint32_t> styleUseCount;
+    };
+
+    void SetCellMode(ConversionContext& ctx, bool on);
+    bool IsCellMode(const ConversionContext& ctx);
+
+    void SetCellBreakMode(ConversionContext& ctx, CellBreakMode mode);
+    void SetCellParagraphMode(ConversionContext& ctx, CellBreakMode mode);
 
-    void SetCellBreakMode(CellBreakMode mode);
-    void SetCellParagraphMode(CellBreakMode mode);
+    //   (BrTag å ؽƮ ٹٲ)
+    void SetTextMode(ConversionContext& ctx, bool on);
+    bool IsTextMode(const ConversionContext& ctx);
+    void SetTextSeparators(ConversionContext& ctx, const std::string& cellSeparator, const std::string& rowSeparator);
+
+    // JSONL ûũ  (  +  /ũ  , render/ChunkWriter.h)
+    // - ڴ JSON ̽ؼ ٽ ϹǷ SetTextSeparators ڿ ȣ
+    void SetChunkMode(ConversionContext& ctx, std::size_t budget);
+    bool IsChunkMode(const ConversionContext& ctx);
+    void FinishChunks(ConversionContext& ctx, std::string& out);
+
+    //  ǥ / (JSONL̸ ֻ ǥ ûũ  )
+    void BeginTextTable(ConversionContext& ctx, std::string& out);
+    void EndTextTable(ConversionContext& ctx, const std::string& out);
+
+    //    ( HTML ٽ  ʰ   )
+    // - /ٹٲ/<br/>   ,  ǥ µǸ ̴ 
+    void BeginCellContent(ConversionContext& ctx);
+    void MarkCellVisibleContent(ConversionContext& ctx);
+    bool CellHasVisibleContent(const ConversionContext& ctx);
 
     // ===========================
     // List state machine
     // ===========================
-    void EnsureListOpen(std::wstring& out, const SDK::ListInfo& info);
-    void FlushList(std::wstring& out);
-    void BeginListItemMode(const SDK::ListInfo& info);
+    void EnsureListOpen(ConversionContext& ctx, std::string& out, const SDK::ListInfo& info);
+    void FlushList(ConversionContext& ctx, std::string& out);
+    void BeginListItemMode(ConversionContext& ctx, const SDK::ListInfo& info);
 
     // Paragraph lifecycle
-    void BeginParagraph(OWPML::CPType* para);
-    void ProcessText(OWPML::CT* text);
-    void ProcessLineSeg();
-    void EndParagraph(std::wstring& out);
+    void BeginParagraph(ConversionContext& ctx, OWPML::CPType* para);
+    void ProcessText(ConversionContext& ctx, OWPML::CT* text);
+    void ProcessLineSeg(ConversionContext& ctx);
+    void EndParagraph(ConversionContext& ctx, std::string& out);
+
+    // Paragraph lifecycle (SDK-free: native reader)
+    void BeginParagraphWithStyle(ConversionContext& ctx, unsigned int styleID);
+    void AppendText(ConversionContext& ctx, const std::wstring& text);     // wide  UTF-8 (SDK )
+    void AppendTextUtf8(ConversionContext& ctx, std::string_view text);   // ̹ UTF-8 (Ƽ )
+    void AppendLineBreak(ConversionContext& ctx);
 
     // Document wrapper
-    void BeginHtmlDocument(std::wstring& out);
-    void EndHtmlDocument(std::wstring& out);
+    void BeginHtmlDocument(std::string& out);
+    void EndHtmlDocument(std::string& out);
 
     // Style log
-    void DumpStyleLogToConsole();
+    void DumpStyleLogToConsole(const ConversionContext& ctx);
+    void MergeStyleLog(ConversionContext& into, const ConversionContext& from);  //     ġ
 
 } // namespace Html
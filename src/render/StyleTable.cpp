@@ -0,0 +1,113 @@
+#include "render/StyleTable.h"
+#include "render/HtmlEscape.h"
+#include "native/Utf8.h"
+
+#include <algorithm>
+#include <cwctype>
+
+namespace Html {
+
+    // ===========================
+    // Outline style mapping
+    // ===========================
+    int ExtractOutlineLevel(const std::wstring& engName)
+    {
+        const std::wstring prefix = L"Outline ";
+        if (engName.rfind(prefix, 0) != 0) return 0;
+
+        int level = 0;
+        for (size_t i = prefix.size(); i < engName.size(); ++i)
+        {
+            if (!iswdigit(engName[i])) break;
+            level = level * 10 + (engName[i] - L'0');
+        }
+        return level;
+    }
+
+    static std::string MapLevelToTag(int level)
+    {
+        if (level >= 1 && level <= 6)
+            return "h" + std::to_string(level);
+
+        return "p";
+    }
+
+    static std::string NormalizeClassName(const std::wstring& engName, int level)
+    {
+        if (level >= 1 && level <= 10)
+            return "outline-" + std::to_string(level);
+
+        // Ÿ ̸     Ӽ ̽
+        std::string name;
+        Native::AppendWideAsUtf8(name, engName);
+
+        std::string cls;
+        AppendEscaped(cls, name);
+        return cls;
+    }
+
+    static bool IsMappedEngName(const std::wstring& engName)
+    {
+        if (engName.rfind(L"Outline ", 0) == 0) return true;
+        if (engName == L"Normal") return true;
+        if (engName == L"Body") return true;
+        return false;
+    }
+
+    static StyleTag CompileTag(const std::wstring& engName)
+    {
+        StyleTag t;
+        t.engName = engName;
+        t.outlineLevel = ExtractOutlineLevel(engName);
+        t.tag = MapLevelToTag(t.outlineLevel);
+        t.cls = NormalizeClassName(engName, t.outlineLevel);
+        t.open = "<" + t.tag + " class=\"" + t.cls + "\">";
+        t.close = "</" + t.tag + ">\n";
+        t.mapped = IsMappedEngName(engName);
+        return t;
+    }
+
+    // ===========================
+    // StyleTable
+    // ===========================
+    StyleTable::StyleTable()
+    {
+        m_tags.push_back(CompileTag(L"Body"));
+    }
+
+    void StyleTable::Compile(const SDK::HeadIndex& head)
+    {
+        m_tags.resize(1);
+        m_slotById.clear();
+        m_sparse.clear();
+
+        // styleMap ID   ū ID ״ ĵ ä m_sparse
+        std::uint32_t maxDense = 0;
+        for (const auto& kv : head.styleMap)
+        {
+            if (kv.first < DENSE_ID_LIMIT) maxDense = std::max<std::uint32_t>(maxDense, kv.first + 1);
+        }
+        m_slotById.assign(maxDense, 0);
+        m_tags.reserve(head.styleMap.size() + 1);
+
+        for (const auto& kv : head.styleMap)
+        {
+            const std::uint32_t slot = (std::uint32_t)m_tags.size();
+            m_tags.push_back(CompileTag(kv.second));
+
+            if (kv.first < DENSE_ID_LIMIT) m_slotById[kv.first] = slot;
+            else m_sparse.emplace_back(kv.first, slot);
+        }
+    }
+
+    std::uint32_t StyleTable::SlotOf(unsigned int styleID) const
+    {
+        if (styleID < m_slotById.size()) return m_slotById[styleID];
+        if (m_sparse.empty()) return 0;
+
+        auto it = std::lower_bound(m_sparse.begin(), m_sparse.end(), styleID,
+            [](const std::pair<std::uint32_t, std::uint32_t>& e, unsigned int id) { return e.first < id; });
+        return (it != m_sparse.end() && it->first == styleID) ? it->second : 0;
+    }
+
+} // namespace Html
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "sdk/SDK_Wrapper.h"
+
+namespace Html {
+
+    // =========================================================
+    //  Ÿ  ϼ HTML ±  ( ʱȭ    )
+    // - ܸ Ÿ ̸ /"Outline N" Ľ/±   
+    //   BeginParagraph ID   迭 ȸ, EndParagraph open/close append
+    // -  0 忡  Ÿ ID ⺻ ("Body")
+    // -   б  (  Ŀ 纻 ״ )
+    // =========================================================
+    struct StyleTag
+    {
+        std::wstring engName;       // ȭ engName (Ÿ α)
+        std::string tag;            // "h1".."h6" / "p"
+        std::string cls;            // "outline-N" / ̽ engName
+        std::string open;           // <tag class="cls">
+        std::string close;          // </tag>\n
+        int outlineLevel = 0;       // "Outline N" N (ƴϸ 0)
+        bool mapped = false;        // Ÿ α MAPPED з
+    };
+
+    class StyleTable
+    {
+    public:
+        // ID ̺ ũ  迭  Ž ( 迭 Ǯ ʰ)
+        static constexpr std::uint32_t DENSE_ID_LIMIT = 1u << 16;
+
+        StyleTable();
+
+        void Compile(const SDK::HeadIndex& head);
+
+        std::uint32_t SlotOf(unsigned int styleID) const;
+        const StyleTag& At(std::uint32_t slot) const { return m_tags[slot]; }
+        std::size_t SlotCount() const { return m_tags.size(); }
+
+    private:
+        std::vector<StyleTag> m_tags;                       //   ±
+        std::vector<std::uint32_t> m_slotById;              // Ÿ ID   (0: )
+        std::vector<std::pair<std::uint32_t, std::uint32_t>> m_sparse;  // ū ID (ID  )
+    };
+
+    // "Outline N"  N (ƴϸ 0)
+    int ExtractOutlineLevel(const std::wstring& engName);
+
+} // namespace Html
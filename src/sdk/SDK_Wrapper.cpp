@@ -1,17 +1,20 @@
+#include <algorithm>
 #include <cwctype>
 #include <map>
 #include <string>
+#include <vector>
 #include <cstdint>
 
+#include "sdk/SdkConfig.h"
+#if HWPX_USE_OWPML_SDK
 #include "sdk/OwpmSDKPrelude.h"
+#endif
 #include "sdk/SDK_Wrapper.h"
 
 namespace {
     // =========================
-    // Style map
+    // Style name
     // =========================
-    std::map<unsigned int, std::wstring> g_styleMap;
-
     static std::wstring Trim(const std::wstring& s)
     {
         size_t start = 0;
@@ -53,25 +56,30 @@ namespace {
     }
 
     // =========================
-    // List maps
+    // Head index helpers
     // =========================
-    struct ParaPrListMeta {
-        SDK::ListKind kind = SDK::ListKind::None;
-        std::uint32_t idRef = 0;
-        std::uint32_t level = 0;
-    };
-
-    std::map<std::uint32_t, ParaPrListMeta> g_paraPrListMeta;
-
-    struct BulletMeta {
-        std::wstring ch;
-        std::wstring checkedCh;
-        bool checkable = false;
-    };
-    std::map<std::uint32_t, BulletMeta> g_bulletMetaById;
-
-    // numbering  θ
-    std::map<std::uint32_t, bool> g_numberingExistsById;
+
+    // ID   +  ID  ͸  (std::map ʷ  Ͱ  )
+    template <class T, class KeyFn>
+    static void SortByIdLastWins(std::vector<T>& items, KeyFn key)
+    {
+        std::stable_sort(items.begin(), items.end(), [&](const T& a, const T& b) { return key(a) < key(b); });
+
+        size_t w = 0;
+        for (size_t r = 0; r < items.size(); ++r)
+        {
+            if (w > 0 && key(items[w - 1]) == key(items[r])) items[w - 1] = items[r];
+            else items[w++] = items[r];
+        }
+        items.resize(w);
+    }
+
+    template <class T, class KeyFn>
+    static const T* FindById(const std::vector<T>& items, std::uint32_t id, KeyFn key)
+    {
+        auto it = std::lower_bound(items.begin(), items.end(), id, [&](const T& a, std::uint32_t v) { return key(a) < v; });
+        return (it != items.end() && key(*it) == id) ? &*it : nullptr;
+    }
 }
 
 namespace SDK {
@@ -79,27 +87,42 @@ namespace SDK {
     // =========================
     // Style
     // =========================
-    void InitStyleMap(OWPML::CStyles* pStyles) {
+#if HWPX_USE_OWPML_SDK
+    void InitStyleMap(HeadIndex& head, OWPML::CStyles* pStyles) {
         if (!pStyles) return;
-        g_styleMap.clear();
 
+        std::vector<StyleEntry> entries;
         const unsigned int count = pStyles->GetItemCnt();
+        entries.reserve(count);
         for (unsigned int i = 0; i < count; ++i) {
             auto* pStyle = pStyles->Getstyle((int)i);
             if (!pStyle) continue;
 
-            std::wstring raw = pStyle->GetEngName();
-            std::wstring norm = NormalizeStyleEngName(raw);
-            g_styleMap[pStyle->GetId()] = norm;
+            StyleEntry e;
+            e.id = pStyle->GetId();
+            e.engName = pStyle->GetEngName();
+            entries.push_back(std::move(e));
+        }
+
+        InitStyleMap(head, entries);
+    }
+#endif
+
+    void InitStyleMap(HeadIndex& head, const std::vector<StyleEntry>& styles) {
+        head.styleMap.clear();
+
+        for (const auto& e : styles) {
+            head.styleMap[e.id] = NormalizeStyleEngName(e.engName);
         }
     }
 
-    std::wstring GetStyleEngName(unsigned int styleID) {
-        auto it = g_styleMap.find(styleID);
-        if (it != g_styleMap.end()) return it->second;
+    std::wstring GetStyleEngName(const HeadIndex& head, unsigned int styleID) {
+        auto it = head.styleMap.find(styleID);
+        if (it != head.styleMap.end()) return it->second;
         return L"Body";
     }
 
+#if HWPX_USE_OWPML_SDK
     // =========================
     // Tree helpers
     // =========================
@@ -125,6 +148,18 @@ namespace SDK {
         return *it;
     }
 
+    void BuildChildView(OWPML::CObject* obj, ChildView& view) {
+        view.items.clear();
+        if (!obj) return;
+        auto* list = obj->GetObjectList();
+        if (!list) return;
+
+        view.items.reserve(list->size());
+        for (auto* ch : *list) {
+            view.items.push_back(ch);
+        }
+    }
+
     // =========================
     // Paragraph / Text
     // =========================
@@ -149,127 +184,220 @@ namespace SDK {
         if (!para) return 0;
         return (unsigned int)para->GetParaPrIDRef();
     }
+#endif
 
     // ============================================================
     // LIST INIT
     // ============================================================
 
-    void InitNumberings(OWPML::CNumberings* numberings)
+#if HWPX_USE_OWPML_SDK
+    void InitNumberings(HeadIndex& head, OWPML::CNumberings* numberings)
     {
-        g_numberingExistsById.clear();
-        if (!numberings) return;
-
-        const unsigned int count = numberings->GetItemCnt();
-        for (unsigned int i = 0; i < count; ++i)
+        std::vector<std::uint32_t> ids;
+        if (numberings)
         {
-            auto* n = numberings->Getnumbering((int)i);
-            if (!n) continue;
-            g_numberingExistsById[(std::uint32_t)n->GetId()] = true;
+            const unsigned int count = numberings->GetItemCnt();
+            for (unsigned int i = 0; i < count; ++i)
+            {
+                auto* n = numberings->Getnumbering((int)i);
+                if (!n) continue;
+                ids.push_back((std::uint32_t)n->GetId());
+            }
         }
+
+        InitNumberings(head, ids);
     }
 
-    void InitBullets(OWPML::CBullets* bullets)
+    void InitBullets(HeadIndex& head, OWPML::CBullets* bullets)
     {
-        g_bulletMetaById.clear();
-        if (!bullets) return;
-
-        const unsigned int count = bullets->GetItemCnt();
-        for (unsigned int i = 0; i < count; ++i)
+        std::vector<BulletEntry> entries;
+        if (bullets)
         {
-            auto* b = bullets->Getbullet((int)i);
-            if (!b) continue;
+            const unsigned int count = bullets->GetItemCnt();
+            for (unsigned int i = 0; i < count; ++i)
+            {
+                auto* b = bullets->Getbullet((int)i);
+                if (!b) continue;
 
-            BulletMeta meta;
-            meta.ch = b->GetChar() ? b->GetChar() : L"";
-            meta.checkedCh = b->GetCheckedChar() ? b->GetCheckedChar() : L"";
+                BulletEntry e;
+                e.id = (std::uint32_t)b->GetId();
+                e.ch = b->GetChar() ? b->GetChar() : L"";
+                e.checkedCh = b->GetCheckedChar() ? b->GetCheckedChar() : L"";
 
-            // checkable paraHead 
-            auto* ph = b->GetparaHead(0);
-            if (ph)
-            {
-                // GetCheckable() int/UINT  Ȯ ŭ
-                meta.checkable = (ph->GetCheckable() != 0);
+                // checkable paraHead 
+                auto* ph = b->GetparaHead(0);
+                if (ph)
+                {
+                    // GetCheckable() int/UINT  Ȯ ŭ
+                    e.checkable = (ph->GetCheckable() != 0);
+                }
+
+                entries.push_back(std::move(e));
             }
+        }
+
+        InitBullets(head, entries);
+    }
+
+    void InitParaProperties(HeadIndex& head, OWPML::CParaProperties* paraProps)
+    {
+        std::vector<ParaPrEntry> entries;
+        if (paraProps)
+        {
+            const unsigned int count = paraProps->GetItemCnt();
+            entries.reserve(count);
 
-            g_bulletMetaById[(std::uint32_t)b->GetId()] = meta;
+            for (unsigned int i = 0; i < count; ++i)
+            {
+                auto* paraPr = paraProps->GetparaPr((int)i);
+                if (!paraPr) continue;
+
+                ParaPrEntry e;
+                e.id = (std::uint32_t)paraPr->GetId();
+
+                auto* heading = paraPr->Getheading();
+                if (heading)
+                {
+                    e.headingIdRef = (std::uint32_t)heading->GetIdRef();
+                    e.headingLevel = (std::uint32_t)heading->GetLevel();
+                }
+
+                entries.push_back(e);
+            }
         }
+
+        InitParaProperties(head, entries);
+    }
+#endif
+
+    void InitNumberings(HeadIndex& head, const std::vector<std::uint32_t>& numberingIds)
+    {
+        head.numberingIds = numberingIds;
+        std::sort(head.numberingIds.begin(), head.numberingIds.end());
+        head.numberingIds.erase(std::unique(head.numberingIds.begin(), head.numberingIds.end()), head.numberingIds.end());
     }
 
-    void InitParaProperties(OWPML::CParaProperties* paraProps)
+    void InitBullets(HeadIndex& head, const std::vector<BulletEntry>& bullets)
     {
-        g_paraPrListMeta.clear();
-        if (!paraProps) return;
+        head.bullets.clear();
+        head.bulletStrings.assign(1, std::wstring());
+
+        // ۸Ӹ ڴ        ڿ ȣ ϳ
+        std::map<std::wstring, std::uint32_t> interned;
+        interned.emplace(std::wstring(), 0);
+
+        auto intern = [&](const std::wstring& s) -> std::uint32_t {
+            auto it = interned.find(s);
+            if (it != interned.end()) return it->second;
+
+            const std::uint32_t index = (std::uint32_t)head.bulletStrings.size();
+            head.bulletStrings.push_back(s);
+            interned.emplace(s, index);
+            return index;
+        };
+
+        head.bullets.reserve(bullets.size());
+        for (const auto& e : bullets)
+        {
+            BulletMeta meta;
+            meta.id = e.id;
+            meta.ch = intern(e.ch);
+            meta.checkedCh = intern(e.checkedCh);
+            meta.checkable = e.checkable;
+            head.bullets.push_back(meta);
+        }
 
-        const unsigned int count = paraProps->GetItemCnt();
+        SortByIdLastWins(head.bullets, [](const BulletMeta& m) { return m.id; });
+    }
+
+    void InitParaProperties(HeadIndex& head, const std::vector<ParaPrEntry>& paraProps)
+    {
+        head.listByParaPr.clear();
+        head.listSparse.clear();
 
-        for (unsigned int i = 0; i < count; ++i)
+        std::uint32_t denseCount = 0;
+        for (const auto& e : paraProps)
         {
-            auto* paraPr = paraProps->GetparaPr((int)i);
-            if (!paraPr) continue;
+            if (e.id < HeadIndex::DENSE_ID_LIMIT) denseCount = std::max<std::uint32_t>(denseCount, e.id + 1);
+        }
+        head.listByParaPr.assign(denseCount, ParaPrListMeta{});
 
-            const std::uint32_t paraPrId = (std::uint32_t)paraPr->GetId();
+        for (const auto& e : paraProps)
+        {
             ParaPrListMeta meta;
 
-            auto* heading = paraPr->Getheading();
-            if (heading)
+            const std::uint32_t idRef = e.headingIdRef;
+
+            //  ٽ: idRef 0̸ "Ʈ ƴ"
+            if (idRef != 0)
             {
-                const std::uint32_t idRef = (std::uint32_t)heading->GetIdRef();
-                const std::uint32_t level = (std::uint32_t)heading->GetLevel();
+                const bool isNumbering = std::binary_search(head.numberingIds.begin(), head.numberingIds.end(), idRef);
+                const BulletMeta* bullet = FindById(head.bullets, idRef, [](const BulletMeta& m) { return m.id; });
 
-                //  ٽ: idRef 0̸ "Ʈ ƴ"
-                if (idRef != 0)
+                //  ٽ:  bullets/numberings  ϳ   Ʈ 
+                if (isNumbering || bullet)
                 {
-                    const bool isNumbering = (g_numberingExistsById.find(idRef) != g_numberingExistsById.end());
-                    const bool isBullet = (g_bulletMetaById.find(idRef) != g_bulletMetaById.end());
+                    meta.kind = isNumbering ? ListKind::Numbering : ListKind::Bullet;
+                    meta.idRef = idRef;
+                    meta.level = e.headingLevel;
 
-                    //  ٽ:  bullets/numberings  ϳ   Ʈ 
-                    if (isNumbering || isBullet)
+                    if (!isNumbering)
                     {
-                        meta.kind = isNumbering ? ListKind::Numbering : ListKind::Bullet;
-                        meta.idRef = idRef;
-                        meta.level = level;
+                        meta.bulletChar = bullet->ch;
+                        meta.checkable = bullet->checkable;
                     }
                 }
             }
 
-            g_paraPrListMeta[paraPrId] = meta;
+            if (e.id < HeadIndex::DENSE_ID_LIMIT) head.listByParaPr[e.id] = meta;
+            else head.listSparse.emplace_back(e.id, meta);
         }
+
+        SortByIdLastWins(head.listSparse, [](const std::pair<std::uint32_t, ParaPrListMeta>& p) { return p.first; });
     }
 
     // ============================================================
     // LIST INFO EXTRACT
     // ============================================================
-    ListInfo GetListInfoFromParagraph(OWPML::CPType* para)
+#if HWPX_USE_OWPML_SDK
+    ListInfo GetListInfoFromParagraph(const HeadIndex& head, OWPML::CPType* para)
     {
-        ListInfo info;
-        if (!para) return info;
+        if (!para) return ListInfo{};
+        return GetListInfoFromParaPr(head, (std::uint32_t)GetParaPrIDRef(para));
+    }
+#endif
 
-        const std::uint32_t paraPrId = (std::uint32_t)GetParaPrIDRef(para);
+    ListInfo GetListInfoFromParaPr(const HeadIndex& head, std::uint32_t paraPrId)
+    {
+        ListInfo info;
         if (paraPrId == 0) return info;
 
-        auto it = g_paraPrListMeta.find(paraPrId);
-        if (it == g_paraPrListMeta.end()) return info;
-
-        const ParaPrListMeta& meta = it->second;
+        const ParaPrListMeta* meta = nullptr;
+        if (paraPrId < head.listByParaPr.size())
+        {
+            meta = &head.listByParaPr[paraPrId];
+        }
+        else if (!head.listSparse.empty())
+        {
+            auto* p = FindById(head.listSparse, paraPrId, [](const std::pair<std::uint32_t, ParaPrListMeta>& e) { return e.first; });
+            if (p) meta = &p->second;
+        }
+        if (!meta) return info;
 
         // meta None̸ ״ 
-        if (meta.kind == ListKind::None) return info;
+        if (meta->kind == ListKind::None) return info;
 
         //  ġ: idRef==0̸ Ʈ ġ 
-        if (meta.idRef == 0) return info;
+        if (meta->idRef == 0) return info;
 
-        info.kind = meta.kind;
-        info.idRef = meta.idRef;
-        info.level = meta.level;
+        info.kind = meta->kind;
+        info.idRef = meta->idRef;
+        info.level = meta->level;
 
         if (info.kind == ListKind::Bullet)
         {
-            auto bit = g_bulletMetaById.find(info.idRef);
-            if (bit != g_bulletMetaById.end())
-            {
-                info.bulletChar = bit->second.ch;
-                info.checkable = bit->second.checkable;
-            }
+            info.bulletChar = head.bulletStrings[meta->bulletChar];
+            info.checkable = meta->checkable;
         }
 
         return info;
@@ -1,5 +1,9 @@
 #pragma once
+#include <map>
 #include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
 #include <cstdint>
 
 namespace OWPML {
@@ -19,22 +23,36 @@ namespace OWPML {
 
 namespace SDK {
 
+    struct HeadIndex;
+
     // ===== Ÿ  =====
-    void InitStyleMap(OWPML::CStyles* styles);
-    std::wstring GetStyleEngName(unsigned int styleID);
+    void InitStyleMap(HeadIndex& head, OWPML::CStyles* styles);
+    std::wstring GetStyleEngName(const HeadIndex& head, unsigned int styleID);
 
     // ===== Ʈ Ž(Ϳ) =====
     unsigned int GetID(OWPML::CObject* obj);
 
     int GetChildCountObj(OWPML::CObject* obj);
-    OWPML::CObject* GetChildAtObj(OWPML::CObject* obj, int index);
+    OWPML::CObject* GetChildAtObj(OWPML::CObject* obj, int index);   // ȣ⸶ O(index): ε  ChildView
+
+    // ===== ڽ ε  =====
+    // - Objectlist   Ⱦ  迭 ( At(i) O(1))
+    // -  並  忡 ϸ 뷮  (BuildChildView  )
+    struct ChildView {
+        std::vector<OWPML::CObject*> items;
+
+        int Count() const { return (int)items.size(); }
+        OWPML::CObject* At(int index) const { return (index >= 0 && index < Count()) ? items[index] : nullptr; }
+    };
+
+    void BuildChildView(OWPML::CObject* obj, ChildView& view);
 
     // =====  Ÿ =====
     unsigned int GetParaStyleID(OWPML::CPType* para);
 
     // ===== CT ؽƮ  =====
     int GetChildCount(OWPML::CT* text);
-    OWPML::CObject* GetChildByIndex(OWPML::CT* text, int index);
+    OWPML::CObject* GetChildByIndex(OWPML::CT* text, int index);     // ε  BuildChildView(text, ...)
 
     // =====  =====
     std::wstring GetCharValue(OWPML::CChar* ch);
@@ -52,6 +70,7 @@ namespace SDK {
         Bullet = 2
     };
 
+    // ܸ  ȯ (    )
     struct ListInfo {
         ListKind kind = ListKind::None;
 
@@ -62,18 +81,89 @@ namespace SDK {
         std::uint32_t level = 0;
 
         // bullet   ۸Ӹ  (  ϴ )
-        std::wstring bulletChar;
+        // - ȸ HeadIndex  ڿ Ŵ (HeadIndex     )
+        std::wstring_view bulletChar;
 
         // üũ(checkbox)  (å   )
         bool checkable = false;
     };
 
-    // Head paraPr/numberings/bullets  
-    void InitParaProperties(OWPML::CParaProperties* paraProps);
-    void InitBullets(OWPML::CBullets* bullets);
-    void InitNumberings(OWPML::CNumberings* numberings);
+    // ============================================================
+    // HEAD INDEX (ȯ 1 , ConversionContext )
+    // ============================================================
+
+    // paraPr ϳ Ʈ  (bullet ۸Ӹ  ڿ ȣ)
+    struct ParaPrListMeta {
+        ListKind kind = ListKind::None;
+        bool checkable = false;
+        std::uint32_t idRef = 0;
+        std::uint32_t level = 0;
+        std::uint32_t bulletChar = 0;       // bulletStrings ȣ (0:  ڿ)
+    };
+
+    struct BulletMeta {
+        std::uint32_t id = 0;
+        std::uint32_t ch = 0;               // bulletStrings ȣ
+        std::uint32_t checkedCh = 0;
+        bool checkable = false;
+    };
+
+    // - Ʈ ȸ paraPr ID  迭   (ū ID  迭  Ž)
+    // - Init* Ŀ б    尡  о 
+    struct HeadIndex {
+        // ID ̺ ũ  迭 ( 迭 Ǯ ʰ)
+        static constexpr std::uint32_t DENSE_ID_LIMIT = 1u << 16;
+
+        std::map<unsigned int, std::wstring> styleMap;              // styleID  ȭ engName
+
+        std::vector<ParaPrListMeta> listByParaPr;                   // paraPr ID  Ʈ  (kind None: Ʈ ƴ)
+        std::vector<std::pair<std::uint32_t, ParaPrListMeta>> listSparse;   // ū paraPr ID (ID  )
+
+        std::vector<std::wstring> bulletStrings;                    // ϵ ۸Ӹ  ([0] =  ڿ)
+
+        // InitParaProperties ϴ  (ID  , ߺ )
+        std::vector<BulletMeta> bullets;
+        std::vector<std::uint32_t> numberingIds;                    // numbering  θ
+    };
+
+    // Head paraPr/numberings/bullets ε  (numberings/bullets  paraPr )
+    void InitParaProperties(HeadIndex& head, OWPML::CParaProperties* paraProps);
+    void InitBullets(HeadIndex& head, OWPML::CBullets* bullets);
+    void InitNumberings(HeadIndex& head, OWPML::CNumberings* numberings);
 
     //  Ʈ Ǻ + bullet char 
-    ListInfo GetListInfoFromParagraph(OWPML::CPType* para);
+    ListInfo GetListInfoFromParagraph(const HeadIndex& head, OWPML::CPType* para);
+
+    // ============================================================
+    // HEAD INPUT (SDK )
+    // - Ƽ  header.xml о  Ʈ  ä
+    // -  OWPML Ÿ Init*  ο Ʈ ȯ  θ Ž
+    // ============================================================
+
+    struct StyleEntry {
+        unsigned int id = 0;
+        std::wstring engName;       // ȭ  engName
+    };
+
+    struct BulletEntry {
+        std::uint32_t id = 0;
+        std::wstring ch;
+        std::wstring checkedCh;
+        bool checkable = false;     // ù paraHead 
+    };
+
+    struct ParaPrEntry {
+        std::uint32_t id = 0;
+        std::uint32_t headingIdRef = 0;
+        std::uint32_t headingLevel = 0;
+    };
+
+    void InitStyleMap(HeadIndex& head, const std::vector<StyleEntry>& styles);
+    void InitNumberings(HeadIndex& head, const std::vector<std::uint32_t>& numberingIds);
+    void InitBullets(HeadIndex& head, const std::vector<BulletEntry>& bullets);
+    void InitParaProperties(HeadIndex& head, const std::vector<ParaPrEntry>& paraProps);  // numberings/bullets  ȣ
+
+    // paraPrIDRef Ʈ Ǻ (GetListInfoFromParagraph ü)
+    ListInfo GetListInfoFromParaPr(const HeadIndex& head, std::uint32_t paraPrId);
 
 } // namespace SDK
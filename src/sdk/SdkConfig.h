@@ -0,0 +1,15 @@
+#pragma once
+
+// =========================================================
+// OWPML SDK  
+// - Windows : ⺻ 1 ( OWPML SDK ũ)
+// -  (Linux Ŀ ): 0  Ƽ (src/native) 
+// -   /D HWPX_USE_OWPML_SDK=0
+// =========================================================
+#ifndef HWPX_USE_OWPML_SDK
+#ifdef _WIN32
+#define HWPX_USE_OWPML_SDK 1
+#else
+#define HWPX_USE_OWPML_SDK 0
+#endif
+#endif
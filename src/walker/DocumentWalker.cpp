@@ -1,105 +1,507 @@
 #include "walker/DocumentWalker.h"
 #include "walker/WalkerConfig.h"
-#include "walker/WalkerDebug.h"
+#include "walker/WalkerTree.h"
 #include "walker/TableRenderer.h"
-#include "sdk/OwpmSDKPrelude.h"
+#include "walker/ElementHandlers.h"
+#include "native/HwpxPackage.h"
 
+#include <cstdint>
 #include <string>
 #include <iostream>
+#include <type_traits>
+#include <utility>
+#include <vector>
 
 #include "sdk/SDK_Wrapper.h"
 #include "render/HtmlRenderer.h"
 
-// forward decl
-static void ExtractTextImpl(OWPML::CObject* object, std::wstring& out, int depth);
+//  : Ʈ /ݱ +   
+template <class Tree>
+static void BeginParagraphWithList(ConversionContext& ctx, typename Tree::Node* para, std::string& out)
+{
+    //  Ʈ ũ   Ǻ  (JSONL ûũ list ǥÿ Ǻ)
+    if (Html::IsTextMode(ctx))
+    {
+        if (Html::IsChunkMode(ctx) && !Html::IsCellMode(ctx))
+            Html::BeginListItemMode(ctx, Tree::GetListInfo(ctx, para));
+        Tree::BeginParagraph(ctx, para);
+        return;
+    }
+
+    // Ʈ Ǻ (  )
+    SDK::ListInfo li;
+    if (!Html::IsCellMode(ctx))
+    {
+        li = Tree::GetListInfo(ctx, para);
+    }
 
-static void ExtractTextImpl(OWPML::CObject* object, std::wstring& out, int depth)
+    if (li.kind != SDK::ListKind::None && li.idRef != 0)
+    {
+        Html::EnsureListOpen(ctx, out, li);
+        Html::BeginListItemMode(ctx, li);
+    }
+    else
+    {
+        Html::FlushList(ctx, out);
+    }
+
+    Tree::BeginParagraph(ctx, para);
+}
+
+// =========================================================
+//    ȸ
+// -  (/ǥ/ Լ )   Html ֱ⸦ ȣ
+//   ( /, ǥ   FlushList,  /)
+// - ̴   θ þ    ũ 
+// -  帶 ϳ  (base ʸ Ƿ ø ȣ⵵ )
+// =========================================================
+namespace
 {
-    if (!object) return;
+    enum class FrameKind : unsigned char
+    {
+        Children,   // ڽĸ ȸ
+        Para,       //  EndParagraph
+        Table,      // TableCursor   
+        Cell        //   ȸ,  EndCell
+    };
 
-    if (depth > WalkerConfig::MAX_DEPTH)
+    template <class Tree>
+    struct WalkFrame
     {
-        std::wcout << L"[WARN] Max depth exceeded. Stop recursion.\n";
-        return;
+        using ChildList = std::remove_pointer_t<decltype(Tree::Children(nullptr))>;
+        using ChildIt = decltype(std::declval<ChildList&>().begin());
+
+        FrameKind kind = FrameKind::Children;
+        ChildIt it{};
+        ChildIt end{};
+        int depth = 0;          // ڽ 湮  depth
+        std::size_t table = 0;  // Table/Cell: WalkStack::tables ε
+    };
+
+    template <class Tree>
+    struct WalkStack
+    {
+        std::vector<WalkFrame<Tree>> frames;
+
+        //  ִ ǥ Ŀ ([0, tableCount) ,  뷮  )
+        std::vector<TableRenderer::TableCursor<typename Tree::Node>> tables;
+        std::size_t tableCount = 0;
+    };
+
+    // Ʈ ڵ鷯  (ID  Ʈ ޶ Tree traits )
+    // - PRUNED: Tree::PRUNE_IDS Skip / PLAIN: ġ  (--no-prune)
+    template <class Tree>
+    struct WalkerHandlers
+    {
+        static constexpr ElementHandlers::Entry ENTRIES[] = {
+            { WalkerConfig::TABLE_ROOT_ID, ElementHandlers::Kind::Table },
+            { Tree::PARA_ID, ElementHandlers::Kind::Para },
+            { Tree::TEXT_ID, ElementHandlers::Kind::Text },
+            { Tree::LINESEG_ID, ElementHandlers::Kind::LineSeg },
+        };
+
+        static constexpr ElementHandlers::Registry<> PRUNED{ ENTRIES, Tree::PRUNE_IDS };
+        static constexpr ElementHandlers::Registry<> PLAIN{ ENTRIES };
+
+        // ȯ  ´ ǥ + ߰ ġ(--prune-id) Descend Ȯ
+        static ElementHandlers::Kind Find(const ConversionContext& ctx, std::uint32_t id)
+        {
+            const ElementHandlers::Kind kind = ctx.prune.useDefaults ? PRUNED.Find(id) : PLAIN.Find(id);
+            if (kind == ElementHandlers::Kind::Descend && ctx.prune.IsExtra(id)) return ElementHandlers::Kind::Skip;
+            return kind;
+        }
+    };
+
+    template <class Tree>
+    WalkStack<Tree>& ThreadWalkStack()
+    {
+        static thread_local WalkStack<Tree> stack;
+        return stack;
     }
 
-    OWPML::Objectlist* childList = object->GetObjectList();
-    if (!childList) return;
+    template <class Tree>
+    void PushChildren(WalkStack<Tree>& s, FrameKind kind, typename Tree::Node* node, int depth, std::size_t table = 0)
+    {
+        auto* childList = Tree::Children(node);
 
-    for (OWPML::CObject* child : *childList)
+        //  Children     (Para/Cell  ó  ׻ push)
+        if (kind == FrameKind::Children && (!childList || childList->empty())) return;
+
+        WalkFrame<Tree> f;
+        f.kind = kind;
+        if (childList)
+        {
+            f.it = childList->begin();
+            f.end = childList->end();
+        }
+        f.depth = depth;
+        f.table = table;
+        s.frames.push_back(f);
+    }
+
+    template <class Tree>
+    void PushTable(ConversionContext& ctx, WalkStack<Tree>& s, typename Tree::Node* tableRoot, std::string& out, int depth)
     {
-        if (!child) continue;
+        if (s.tableCount == s.tables.size()) s.tables.emplace_back();
 
-        WalkerDebug::ScanLogOnce(depth, child);
+        if (!TableRenderer::BeginTable(ctx, tableRoot, out, depth, s.tables[s.tableCount])) return;
+
+        WalkFrame<Tree> f;
+        f.kind = FrameKind::Table;
+        f.depth = depth;
+        f.table = s.tableCount++;
+        s.frames.push_back(f);
+    }
+
+    // ڽ ϳ ó (false:     ȸ ߴ)
+    template <class Tree>
+    bool VisitChild(ConversionContext& ctx, WalkStack<Tree>& s, typename Tree::Node* child, std::string& out, int depth)
+    {
+        Tree::ScanLogOnce(depth, child);
+        ++ctx.walk.visitedNodes;
 
-        const unsigned int id = SDK::GetID(child);
+        const unsigned int id = Tree::GetID(child);
 
         if (WalkerConfig::DUMP_MODE && WalkerConfig::DUMP_TARGET_SUBTREE && id == WalkerConfig::TARGET_ID)
         {
             std::wcout << L"\n========== TARGET SUBTREE DUMP START ==========\n";
             std::wcout << L"TARGET_ID=" << WalkerConfig::TARGET_ID << L"\n\n";
-            WalkerDebug::DumpSubtree(child, depth, 0);
+            Tree::DumpSubtree(child, depth, 0);
             std::wcout << L"========== TARGET SUBTREE DUMP END ==========\n\n";
-            return;
+            return false;
         }
 
-        switch (id)
+        switch (WalkerHandlers<Tree>::Find(ctx, id))
         {
-        case WalkerConfig::TABLE_ROOT_ID:
+        case ElementHandlers::Kind::Table:
         {
-            Html::FlushList(out);
-            TableRenderer::RenderTableFromRoot373(child, out, depth, ExtractTextImpl);
+            Html::FlushList(ctx, out);
+            PushTable<Tree>(ctx, s, child, out, depth);
             break;
         }
 
-        case ID_PARA_PType:
+        case ElementHandlers::Kind::Para:
         {
-            auto* para = (OWPML::CPType*)child;
+            BeginParagraphWithList<Tree>(ctx, child, out);
+            PushChildren<Tree>(s, FrameKind::Para, child, depth + 1);
+            break;
+        }
+
+        case ElementHandlers::Kind::Text:
+        {
+            Tree::ProcessText(ctx, child);
+            break;
+        }
+
+        case ElementHandlers::Kind::LineSeg:
+        {
+            Html::ProcessLineSeg(ctx);
+            break;
+        }
+
+        case ElementHandlers::Kind::Skip:
+            ++ctx.walk.prunedSubtrees;
+            ctx.walk.prunedNodes += Tree::SubtreeSize(child);
+            break;
+
+        case ElementHandlers::Kind::Descend:
+        default:
+            PushChildren<Tree>(s, FrameKind::Children, child, depth + 1);
+            break;
+        }
+        return true;
+    }
+
+    // base    ó
+    template <class Tree>
+    void RunFrames(ConversionContext& ctx, WalkStack<Tree>& s, std::string& out, std::size_t base)
+    {
+        using Node = typename Tree::Node;
 
-            // Ʈ Ǻ (  )
-            SDK::ListInfo li;
-            if (!Html::IsCellMode())
+        while (s.frames.size() > base)
+        {
+            const std::size_t top = s.frames.size() - 1;
+            WalkFrame<Tree>& f = s.frames[top];     // push ڿ ȿ   s.frames[top] 
+
+            if (f.kind == FrameKind::Table)
             {
-                li = SDK::GetListInfoFromParagraph(para);
+                const std::size_t table = f.table;
+                const int depth = f.depth;
+
+                Node* cellContent = TableRenderer::NextCell(ctx, out, s.tables[table]);
+                if (!cellContent)
+                {
+                    --s.tableCount;
+                    s.frames.pop_back();
+                    continue;
+                }
+
+                PushChildren<Tree>(s, FrameKind::Cell, cellContent, depth + 1, table);
+                continue;
             }
 
-            if (li.kind != SDK::ListKind::None && li.idRef != 0)
+            if (f.it == f.end)
             {
-                Html::EnsureListOpen(out, li);
-                Html::BeginListItemMode(li);
+                if (f.kind == FrameKind::Para) Html::EndParagraph(ctx, out);
+                else if (f.kind == FrameKind::Cell) TableRenderer::EndCell(ctx, out, s.tables[f.table]);
+
+                s.frames.pop_back();
+                continue;
             }
-            else
+
+            Node* child = *f.it;
+            ++f.it;
+            if (!child) continue;
+
+            if (!VisitChild<Tree>(ctx, s, child, out, f.depth))
+                s.frames[top].it = s.frames[top].end;   //  :    ǳʶ
+        }
+    }
+
+    //  ϳ  ó (false:   ߴ)
+    template <class Tree>
+    bool WalkChild(ConversionContext& ctx, typename Tree::Node* child, std::string& out, int depth)
+    {
+        WalkStack<Tree>& s = ThreadWalkStack<Tree>();
+        const std::size_t base = s.frames.size();
+
+        if (!VisitChild<Tree>(ctx, s, child, out, depth)) return false;
+        RunFrames<Tree>(ctx, s, out, base);
+        return true;
+    }
+
+    // ǥ Ʈ ϳ  (Ʈ ȯ Ʈ  ǥ)
+    template <class Tree>
+    void WalkTable(ConversionContext& ctx, typename Tree::Node* tableRoot, std::string& out, int depth)
+    {
+        WalkStack<Tree>& s = ThreadWalkStack<Tree>();
+        const std::size_t base = s.frames.size();
+
+        PushTable<Tree>(ctx, s, tableRoot, out, depth);
+        RunFrames<Tree>(ctx, s, out, base);
+    }
+
+    // ȯ : ܷ ߴܵ  ȯ   
+    template <class Tree>
+    void ResetWalkStack()
+    {
+        WalkStack<Tree>& s = ThreadWalkStack<Tree>();
+        s.frames.clear();
+        s.tableCount = 0;
+    }
+}
+
+//  Ʈ: ֻ ڽ() ϳ   out STREAM_FLUSH_BYTES  drain
+template <class Tree>
+static bool ExtractSection(ConversionContext& ctx, typename Tree::Node* section, std::string& out, const SectionDrainFn& drain)
+{
+    ResetWalkStack<Tree>();
+
+    auto* childList = section ? Tree::Children(section) : nullptr;
+    if (childList)
+    {
+        for (auto* child : *childList)
+        {
+            if (!child) continue;
+            if (!WalkChild<Tree>(ctx, child, out, 0)) break;
+
+            if (drain && out.size() >= WalkerConfig::STREAM_FLUSH_BYTES)
             {
-                Html::FlushList(out);
+                if (!drain(out)) return false;
+                out.clear();
             }
+        }
+    }
 
-            Html::BeginParagraph(para);
-            ExtractTextImpl(child, out, depth + 1);
-            Html::EndParagraph(out);
-            break;
+    Html::FlushList(ctx, out); //   
+    return true;
+}
+
+#if HWPX_USE_OWPML_SDK
+void ExtractText(ConversionContext& ctx, OWPML::CObject* object, std::string& out)
+{
+    ExtractSection<WalkerTree::SdkTree>(ctx, object, out, nullptr);
+}
+
+bool ExtractText(ConversionContext& ctx, OWPML::CObject* object, std::string& out, const SectionDrainFn& drain)
+{
+    return ExtractSection<WalkerTree::SdkTree>(ctx, object, out, drain);
+}
+#endif
+
+void ExtractText(ConversionContext& ctx, const Native::Node* object, std::string& out)
+{
+    ExtractSection<WalkerTree::NativeTree>(ctx, object, out, nullptr);
+}
+
+bool ExtractText(ConversionContext& ctx, const Native::Node* object, std::string& out, const SectionDrainFn& drain)
+{
+    return ExtractSection<WalkerTree::NativeTree>(ctx, object, out, drain);
+}
+
+// =========================================================
+// Ʈ ȯ
+// - Ʈ ȸ(WalkChild<NativeTree>)   Html ֱ⸦ ȣ
+//   ( /, hp:t  ڿ/ٹٲ, lineseg , ǥ FlushList  )
+// - ǥ ¦ Ǵ </hp:tbl> Ʈ   TableRenderer ѱ
+// =========================================================
+namespace
+{
+    enum class StreamFrame : unsigned char
+    {
+        Walk,   // ڽĸ ȸ
+        Para    //   EndParagraph
+    };
+
+    // StartElement ġ ¦ Ǵ EndElement  (elementCount:    )
+    static bool SkipSubtree(Native::XmlReader& r, std::uint64_t& elementCount)
+    {
+        int nest = 0;
+        for (;;)
+        {
+            switch (r.Next())
+            {
+            case Native::XmlEvent::StartElement: ++nest; ++elementCount; break;
+            case Native::XmlEvent::EndElement: if (nest-- == 0) return true; break;
+            case Native::XmlEvent::Text: break;
+            default: return false;
+            }
         }
+    }
 
-        case ID_PARA_T:
+    // hp:t:  ڿ/ٹٲ޸ (NativeTree::ProcessText )
+    static bool StreamText(ConversionContext& ctx, Native::XmlReader& r, std::string& textBuf)
+    {
+        int nest = 0;
+        for (;;)
         {
-            Html::ProcessText((OWPML::CT*)child);
-            break;
+            switch (r.Next())
+            {
+            case Native::XmlEvent::StartElement:
+                if (nest == 0 && Native::MapSectionElement(r.LocalName()) == Native::NODE_LINEBREAK)
+                    Html::AppendLineBreak(ctx);
+                ++nest;
+                break;
+
+            case Native::XmlEvent::EndElement:
+                if (nest-- == 0) return true;
+                break;
+
+            case Native::XmlEvent::Text:
+                if (nest == 0)
+                {
+                    textBuf.clear();
+                    r.AppendText(textBuf);
+                    Html::AppendTextUtf8(ctx, textBuf);
+                }
+                break;
+
+            default:
+                return false;
+            }
         }
+    }
+}
+
+bool StreamSectionXml(ConversionContext& ctx, const char* xml, std::size_t size, std::string& out, const SectionDrainFn& drain)
+{
+    using Tree = WalkerTree::NativeTree;
+
+    ResetWalkStack<Tree>();
+
+    Native::XmlReader r(xml, size);
 
-        case ID_PARA_LineSeg:
+    // Ʈ(hs:sec)
+    for (;;)
+    {
+        const Native::XmlEvent ev = r.Next();
+        if (ev == Native::XmlEvent::StartElement) break;
+        if (ev != Native::XmlEvent::Text) return false;
+    }
+
+    std::vector<StreamFrame> frames;
+    frames.reserve(64);
+    frames.push_back(StreamFrame::Walk);
+
+    std::string textBuf;
+
+    while (!frames.empty())
+    {
+        switch (r.Next())
+        {
+        case Native::XmlEvent::StartElement:
         {
-            Html::ProcessLineSeg();
+            // Ʈ ȸ  Ҹ 湮  depth
+            const int depth = (int)frames.size() - 1;
+
+            Native::Node node;
+            node.id = Native::MapSectionElement(r.LocalName());
+            ++ctx.walk.visitedNodes;
+
+            switch (WalkerHandlers<Tree>::Find(ctx, node.id))
+            {
+            case ElementHandlers::Kind::Table:
+            {
+                Html::FlushList(ctx, out);
+
+                Native::SectionTree table;
+                if (!Native::BuildSubtree(r, table)) return false;
+                WalkTable<Tree>(ctx, table.root, out, depth);
+                break;
+            }
+
+            case ElementHandlers::Kind::Para:
+                Native::ReadNodeAttrs(r, node);
+                BeginParagraphWithList<Tree>(ctx, &node, out);
+                frames.push_back(StreamFrame::Para);
+                break;
+
+            case ElementHandlers::Kind::Text:
+                if (!StreamText(ctx, r, textBuf)) return false;
+                break;
+
+            case ElementHandlers::Kind::LineSeg:
+            {
+                Html::ProcessLineSeg(ctx);
+                std::uint64_t ignored = 0;
+                if (!SkipSubtree(r, ignored)) return false;
+                break;
+            }
+
+            case ElementHandlers::Kind::Skip:
+                ++ctx.walk.prunedSubtrees;
+                ++ctx.walk.prunedNodes;
+                if (!SkipSubtree(r, ctx.walk.prunedNodes)) return false;
+                break;
+
+            case ElementHandlers::Kind::Descend:
+            default:
+                frames.push_back(StreamFrame::Walk);
+                break;
+            }
             break;
         }
 
-        default:
-            ExtractTextImpl(child, out, depth + 1);
+        case Native::XmlEvent::EndElement:
+            if (frames.back() == StreamFrame::Para)
+                Html::EndParagraph(ctx, out);
+            frames.pop_back();
             break;
+
+        case Native::XmlEvent::Text:
+            break;  // hp:t  ڿ 
+
+        default:
+            return false;   // Ľ  /    
+        }
+
+        if (out.size() >= WalkerConfig::STREAM_FLUSH_BYTES)
+        {
+            if (!drain(out)) return false;
+            out.clear();
         }
     }
-}
 
-void ExtractText(OWPML::CObject* object, std::wstring& out)
-{
-    ExtractTextImpl(object, out, 0);
-    Html::FlushList(out); //   
+    Html::FlushList(ctx, out); //   
+    return true;
 }
@@ -1,10 +1,31 @@
 #pragma once
 
+#include <cstddef>
+#include <functional>
 #include <string>
 
 namespace OWPML {
     class CObject;
 }
 
+namespace Native {
+    struct Node;
+}
+
+struct ConversionContext;
+
+// out WalkerConfig::STREAM_FLUSH_BYTES   drain(out)   ( sink )
+using SectionDrainFn = std::function<bool(const std::string& chunk)>;
+
 //  ̽ 
-void ExtractText(OWPML::CObject* object, std::wstring& out);
+void ExtractText(ConversionContext& ctx, OWPML::CObject* object, std::string& out);
+bool ExtractText(ConversionContext& ctx, OWPML::CObject* object, std::string& out, const SectionDrainFn& drain);
+
+// Ƽ  Ʈ (SDK )
+void ExtractText(ConversionContext& ctx, const Native::Node* object, std::string& out);
+bool ExtractText(ConversionContext& ctx, const Native::Node* object, std::string& out, const SectionDrainFn& drain);
+
+// Ʈ ȯ (Ƽ , Ʈ  sectionN.xml ̺Ʈ ٷ )
+// - ޸𸮴  ū ǥ ϳ з  (ǥ Ʈ  TableRenderer ѱ)
+
+bool StreamSectionXml(ConversionContext& ctx, const char* xml, std::size_t size, std::string& out, const SectionDrainFn& drain);
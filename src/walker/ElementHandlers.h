@@ -0,0 +1,110 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// =========================================================
+//  ID  Ŀ ڵ鷯  ( Ÿ Ʈ)
+// -  (Entry 迭) constexpr ( Ʈ)  迭 
+// - ȸ  Ű    + 迭 ε  Ŀ Kind switch ( ̺)
+// -  (/ʵ/ ) Ͽ   ߰ ( ȣ/if ü )
+// =========================================================
+namespace ElementHandlers
+{
+    enum class Kind : unsigned char
+    {
+        Descend = 0,    //    : ڽĸ ȸ
+        Table,          // TABLE_ROOT: TableRenderer Ŀ
+        Para,           //  /
+        Text,           // hp:t /ٹٲ
+        LineSeg,        // ̾ƿ  ( )
+        Skip            // Ʈ ü ǳʶ (ڰ  )
+    };
+
+    struct Entry
+    {
+        std::uint32_t id;
+        Kind kind;
+    };
+
+    template <std::size_t MaxPages = 4>
+    class Registry
+    {
+    public:
+        static constexpr unsigned int PAGE_BITS = 8;
+        static constexpr std::uint32_t PAGE_SIZE = 1u << PAGE_BITS;
+
+        //  ID      ̱
+        template <std::size_t N>
+        constexpr explicit Registry(const Entry (&entries)[N])
+        {
+            for (std::size_t i = 0; i < N; ++i)
+                Set(entries[i].id, entries[i].kind);
+        }
+
+        // ġ (skipIds) Skip  ְ entries 
+        //  /ǥ  ڵ鷯 Ҵ Ͽ ߸  ǳʶ 
+        template <std::size_t N, std::size_t M>
+        constexpr Registry(const Entry (&entries)[N], const std::uint32_t (&skipIds)[M])
+        {
+            for (std::size_t i = 0; i < M; ++i)
+                Set(skipIds[i], Kind::Skip);
+            for (std::size_t i = 0; i < N; ++i)
+                Set(entries[i].id, entries[i].kind);
+        }
+
+        constexpr Kind Find(std::uint32_t id) const
+        {
+            const std::uint32_t key = id >> PAGE_BITS;
+            for (std::size_t p = 0; p < m_pageCount; ++p)
+            {
+                if (m_pageKeys[p] == key) return m_pages[p][id & (PAGE_SIZE - 1)];
+            }
+            return Kind::Descend;
+        }
+
+    private:
+        constexpr void Set(std::uint32_t id, Kind kind)
+        {
+            const std::uint32_t key = id >> PAGE_BITS;
+
+            std::size_t p = 0;
+            while (p < m_pageCount && m_pageKeys[p] != key) ++p;
+            if (p == m_pageCount)
+            {
+                //  ڶ   (MaxPages ø )
+                if (m_pageCount == MaxPages) throw "ElementHandlers::Registry: too many ID pages";
+                m_pageKeys[m_pageCount++] = key;
+            }
+
+            m_pages[p][id & (PAGE_SIZE - 1)] = kind;
+        }
+
+        std::uint32_t m_pageKeys[MaxPages] = {};
+        Kind m_pages[MaxPages][PAGE_SIZE] = {};
+        std::size_t m_pageCount = 0;
+    };
+
+    // ġ  (ȯ, --no-prune / --prune-id)
+    // - useDefaults: Ʈ ⺻ (WalkerTree PRUNE_IDS) Ʈ Skip 
+    // - extraIds:  ǳʶ  ID (SDK SCAN_MODE α ID, Ƽ  Native::NodeId)
+    //      (Descend)   /ǥ/ Ҵ ־ ǳʶ 
+    struct PruneOptions
+    {
+        bool useDefaults = true;
+        std::vector<std::uint32_t> extraIds;    // , ߺ  (Add  )
+
+        void Add(std::uint32_t id)
+        {
+            auto it = std::lower_bound(extraIds.begin(), extraIds.end(), id);
+            if (it == extraIds.end() || *it != id) extraIds.insert(it, id);
+        }
+
+        bool IsExtra(std::uint32_t id) const
+        {
+            return !extraIds.empty() && std::binary_search(extraIds.begin(), extraIds.end(), id);
+        }
+    };
+}
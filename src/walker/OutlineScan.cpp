@@ -0,0 +1,217 @@
+#include "walker/OutlineScan.h"
+#include "walker/WalkerConfig.h"
+#include "render/ConversionContext.h"
+#include "native/HwpxPackage.h"
+#include "native/Utf8.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#if HWPX_USE_OWPML_SDK
+#include "sdk/OwpmSDKPrelude.h"
+#endif
+
+namespace
+{
+    int OutlineLevelOf(const ConversionContext& ctx, unsigned int styleID)
+    {
+        const int level = ctx.head->styles.At(ctx.head->styles.SlotOf(styleID)).outlineLevel;
+        return (level >= 1 && level <= 10) ? level : 0;
+    }
+
+    void AppendOutlineLine(std::string& out, std::size_t section, std::uint32_t para, int level, const std::string& text)
+    {
+        //   HTML µ 
+        if (!Native::Utf8HasNonSpace(text)) return;
+
+        out += std::to_string(section);
+        out += '\t';
+        out += std::to_string(para);
+        out += '\t';
+        out += std::to_string(level);
+        out += '\t';
+        for (char c : text)
+            out += (c == '\t' || c == '\n' || c == '\r') ? ' ' : c;
+        out += '\n';
+    }
+
+    // hp:t:  ڿ/ٹٲ޸ (Ʈ StreamText  Ģ)
+    bool CollectT(Native::XmlReader& r, std::string& text)
+    {
+        int nest = 0;
+        for (;;)
+        {
+            switch (r.Next())
+            {
+            case Native::XmlEvent::StartElement:
+                if (nest == 0 && Native::MapSectionElement(r.LocalName()) == Native::NODE_LINEBREAK)
+                    text += ' ';
+                ++nest;
+                break;
+
+            case Native::XmlEvent::EndElement:
+                if (nest-- == 0) return true;
+                break;
+
+            case Native::XmlEvent::Text:
+                if (nest == 0) r.AppendText(text);
+                break;
+
+            default:
+                return false;
+            }
+        }
+    }
+
+    //   :   hp:t ڸ, ǥ/̾ƿ  ° ǳʶ
+    bool CollectHeadingText(Native::XmlReader& r, std::string& text)
+    {
+        int nest = 0;
+        for (;;)
+        {
+            switch (r.Next())
+            {
+            case Native::XmlEvent::StartElement:
+                switch (Native::MapSectionElement(r.LocalName()))
+                {
+                case WalkerConfig::TABLE_ROOT_ID:
+                case Native::NODE_LINESEG_ARRAY:
+                case Native::NODE_SEC_PR:
+                case Native::NODE_SHAPE_LAYOUT:
+                    if (!r.SkipElement()) return false;
+                    break;
+                case Native::NODE_TEXT:
+                    if (!CollectT(r, text)) return false;
+                    break;
+                default:
+                    ++nest;
+                    break;
+                }
+                break;
+
+            case Native::XmlEvent::EndElement:
+                if (nest-- == 0) return true;
+                break;
+
+            case Native::XmlEvent::Text:
+                break;
+
+            default:
+                return false;
+            }
+        }
+    }
+}
+
+bool ScanOutlineXml(const ConversionContext& ctx, std::size_t section, const char* xml, std::size_t size, std::string& out)
+{
+    Native::XmlReader r(xml, size);
+
+    // Ʈ(hs:sec)
+    for (;;)
+    {
+        const Native::XmlEvent ev = r.Next();
+        if (ev == Native::XmlEvent::StartElement) break;
+        if (ev != Native::XmlEvent::Text) return false;
+    }
+
+    std::uint32_t para = 0;
+    std::string text;
+
+    for (;;)
+    {
+        switch (r.Next())
+        {
+        case Native::XmlEvent::StartElement:
+        {
+            if (Native::MapSectionElement(r.LocalName()) != Native::NODE_PARA)
+            {
+                if (!r.SkipElement()) return false;
+                break;
+            }
+
+            const std::uint32_t ordinal = para++;
+            const int level = OutlineLevelOf(ctx, r.GetAttrUInt("styleIDRef"));
+            if (level == 0)
+            {
+                //  : ȿ ǥ ־  ؼ  
+                if (!r.SkipElement()) return false;
+                break;
+            }
+
+            text.clear();
+            if (!CollectHeadingText(r, text)) return false;
+            AppendOutlineLine(out, section, ordinal, level, text);
+            break;
+        }
+
+        case Native::XmlEvent::EndElement:
+            return true;    // Ʈ 
+
+        case Native::XmlEvent::Text:
+            break;
+
+        default:
+            return false;
+        }
+    }
+}
+
+#if HWPX_USE_OWPML_SDK
+void ScanOutline(const ConversionContext& ctx, std::size_t section, OWPML::CObject* sectionObj, std::string& out)
+{
+    auto* paras = sectionObj ? sectionObj->GetObjectList() : nullptr;
+    if (!paras) return;
+
+    std::uint32_t para = 0;
+    std::string text;
+    std::vector<OWPML::CObject*> stack;
+    SDK::ChildView chars;
+
+    for (auto* p : *paras)
+    {
+        if (!p || SDK::GetID(p) != ID_PARA_PType) continue;
+
+        const std::uint32_t ordinal = para++;
+        const int level = OutlineLevelOf(ctx, SDK::GetParaStyleID((OWPML::CPType*)p));
+        if (level == 0) continue;
+
+        //   ȸ  (ǥ ǳʶ)
+        text.clear();
+        stack.assign(1, p);
+        while (!stack.empty())
+        {
+            OWPML::CObject* n = stack.back();
+            stack.pop_back();
+
+            const unsigned int id = SDK::GetID(n);
+            if (id == WalkerConfig::TABLE_ROOT_ID) continue;
+
+            if (id == ID_PARA_T)
+            {
+                SDK::BuildChildView(n, chars);
+                for (int i = 0; i < chars.Count(); ++i)
+                {
+                    OWPML::CObject* ch = chars.At(i);
+                    if (!ch) continue;
+                    if (SDK::GetID(ch) == ID_PARA_Char) Native::AppendWideAsUtf8(text, SDK::GetCharValue((OWPML::CChar*)ch));
+                    else if (SDK::GetID(ch) == ID_PARA_LineBreak) text += ' ';
+                }
+                continue;
+            }
+
+            //    Ųٷ 
+            auto* children = n->GetObjectList();
+            if (!children) continue;
+            const std::size_t base = stack.size();
+            for (auto* c : *children)
+                if (c) stack.push_back(c);
+            std::reverse(stack.begin() + (std::ptrdiff_t)base, stack.end());
+        }
+
+        AppendOutlineLine(out, section, ordinal, level, text);
+    }
+}
+#endif
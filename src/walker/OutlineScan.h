@@ -0,0 +1,29 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+#include "sdk/SdkConfig.h"
+
+namespace OWPML {
+    class CObject;
+}
+
+struct ConversionContext;
+
+// =========================================================
+// ()  ĵ:    ܸ 
+// - :  ֻ   Ÿ "Outline 1".."Outline 10" 
+//   (Ÿ   ctx.head->styles ϵ outlineLevel)
+// -  ٿ ϳ: "<>\t<>\t<>\t<>\n"
+//   / 0 ( =  ֻ  ),   /ٹٲ 
+// - ǥ(TABLE_ROOT_ID) Ʈ 䰡 ƴ  ڸ  ʰ ǳʶ
+// =========================================================
+
+// Ƽ : sectionN.xml  ٷ  (Ʈ/̺Ʈ  '<'  ǳʶ)
+bool ScanOutlineXml(const ConversionContext& ctx, std::size_t section, const char* xml, std::size_t size, std::string& out);
+
+#if HWPX_USE_OWPML_SDK
+// SDK  ü
+void ScanOutline(const ConversionContext& ctx, std::size_t section, OWPML::CObject* sectionObj, std::string& out);
+#endif
@@ -1,275 +1,419 @@
 #include "walker/TableRenderer.h"
 #include "walker/WalkerConfig.h"
-#include "walker/WalkerDebug.h"
+#include "walker/WalkerTree.h"
 #include "walker/WalkerUtils.h"
 
-#include <map>
 #include <vector>
 #include <algorithm>
 #include <string>
 #include <iostream>
 
-#include "sdk/OwpmSDKPrelude.h"
 #include "sdk/SDK_Wrapper.h"
 #include "render/HtmlRenderer.h"
 
 namespace
 {
-    struct CellPos
-    {
-        int r = 0;
-        int c = 0;
-
-        bool operator<(const CellPos& o) const
-        {
-            if (r != o.r) return r < o.r;
-            return c < o.c;
-        }
-    };
-
-    struct CellInfo
-    {
-        OWPML::CObject* wrapper = nullptr;
-        OWPML::CObject* content = nullptr;
-        int rowSpan = 1;
-        int colSpan = 1;
-    };
-
-    static bool IsHtmlEffectivelyEmpty(const std::wstring& html)
-    {
-        // "<br/>"  ±׸ ִ 츦 empty  
-        std::wstring s;
-        s.reserve(html.size());
-
-        for (size_t i = 0; i < html.size(); ++i)
-        {
-            wchar_t ch = html[i];
-            if (ch == L' ' || ch == L'\t' || ch == L'\r' || ch == L'\n')
-                continue;
-            s.push_back(ch);
-        }
-
-        const std::wstring br = L"<br/>";
-        size_t pos = 0;
-        while ((pos = s.find(br, pos)) != std::wstring::npos)
-        {
-            s.erase(pos, br.size());
-        }
-
-        return s.empty();
-    }
-}
-
-namespace TableRenderer
-{
-    void RenderTableFromRoot373(
-        OWPML::CObject* tableRoot,
-        std::wstring& out,
+    using TableRenderer::CellInfo;
+    using TableRenderer::CoveredSpan;
+    using TableRenderer::TableCursor;
+
+    template <class Tree>
+    bool BeginTableImpl(
+        ConversionContext& ctx,
+        typename Tree::Node* tableRoot,
+        std::string& out,
         int depth,
-        RenderChildFn renderChild
+        TableCursor<typename Tree::Node>& t
     )
     {
-        if (!tableRoot) return;
-        if (!renderChild) return;
+        using Node = typename Tree::Node;
+
+        if (!tableRoot) return false;
 
-        const unsigned int rid = SDK::GetID(tableRoot);
-        if (rid != WalkerConfig::TABLE_ROOT_ID) return;
+        const unsigned int rid = Tree::GetID(tableRoot);
+        if (rid != WalkerConfig::TABLE_ROOT_ID) return false;
 
-        // (øǥ ) CellMode /
-        const bool prevCellMode = Html::IsCellMode();
+        // (øǥ ) CellMode /
+        t.prevCellMode = Html::IsCellMode(ctx);
 
         // 0) : ǥ ü subtree
         if (WalkerConfig::DUMP_MODE && WalkerConfig::DUMP_TABLE_SUBTREE)
         {
             std::wcout << L"\n========== TABLE SUBTREE DUMP START ==========\n";
             std::wcout << L"TABLE_ROOT_ID=" << WalkerConfig::TABLE_ROOT_ID << L"\n\n";
-            WalkerDebug::DumpSubtree(tableRoot, depth, 0);
+            Tree::DumpSubtree(tableRoot, depth, 0);
             std::wcout << L"========== TABLE SUBTREE DUMP END ==========\n\n";
         }
 
-        // 1) rowGroups 
-        std::vector<OWPML::CObject*> rowGroups;
-        WalkerUtils::CollectChildrenById(tableRoot, WalkerConfig::ROW_GROUP_ID, rowGroups);
-        if (rowGroups.empty())
-        {
-            Html::SetCellMode(prevCellMode);
-            return;
-        }
+        // 1) rowGroup  cellWrapper      
+        //    cellWrapper ڽ(addr/span/content) IndexChildren   з
+        //      켱    (    )
+        enum CellPart { PART_ADDR, PART_SPAN, PART_CONTENT, PART_COUNT };
+        static constexpr unsigned int CELL_PART_IDS[PART_COUNT] = {
+            WalkerConfig::CELL_ADDR_ID,
+            WalkerConfig::CELL_SPAN_ID,
+            WalkerConfig::CELL_CONTENT_ID,
+        };
 
-        // 2) cellWrapper  + (row,col)  
-        std::map<CellPos, CellInfo> cellMap;
+        std::vector<CellInfo<Node>>& cells = t.cells;
+        cells.clear();
 
-        int inferredRowCount = 0;
-        int inferredColCount = 0;
+        // ּҰ   :  ʰ    ڿ  ྿  ( )
+        std::vector<CellInfo<Node>> strayCells;
 
-        for (size_t rg = 0; rg < rowGroups.size(); ++rg)
-        {
-            std::vector<OWPML::CObject*> wrappers;
-            WalkerUtils::CollectChildrenById(rowGroups[rg], WalkerConfig::CELL_WRAPPER_ID, wrappers);
+        int rowGroupCount = 0;
+        int maxStartRow = -1;
+        int colExtent = 0;      //   ϴ    + 1 (span ǥ  )
 
-            for (auto* cellWrapper : wrappers)
+        auto* rowGroups = Tree::Children(tableRoot);
+        if (rowGroups)
+        {
+            for (auto* rowGroup : *rowGroups)
             {
-                if (!cellWrapper) continue;
+                if (!rowGroup || Tree::GetID(rowGroup) != WalkerConfig::ROW_GROUP_ID) continue;
+                ++rowGroupCount;
 
-                // addr ʼ
-                auto* addrObj = WalkerUtils::FindFirstChildById(cellWrapper, WalkerConfig::CELL_ADDR_ID);
-                if (!addrObj) continue;
+                auto* wrappers = Tree::Children(rowGroup);
+                if (!wrappers) continue;
 
-                auto* addr = static_cast<OWPML::CCellAddr*>(addrObj);
-                const int r = (int)addr->GetRowAddr();
-                const int c = (int)addr->GetColAddr();
-
-                // span
-                int colSpan = 1;
-                int rowSpan = 1;
-                if (auto* spanObj = WalkerUtils::FindFirstChildById(cellWrapper, WalkerConfig::CELL_SPAN_ID))
+                for (auto* cellWrapper : *wrappers)
                 {
-                    auto* span = static_cast<OWPML::CCellSpan*>(spanObj);
-                    colSpan = (int)span->GetColSpan();
-                    rowSpan = (int)span->GetRowSpan();
-                    if (colSpan <= 0) colSpan = 1;
-                    if (rowSpan <= 0) rowSpan = 1;
-                }
+                    if (!cellWrapper || Tree::GetID(cellWrapper) != WalkerConfig::CELL_WRAPPER_ID) continue;
+
+                    const auto parts = WalkerUtils::IndexChildren(cellWrapper, CELL_PART_IDS, PART_COUNT);
+
+                    // addr ʼ
+                    auto* addrObj = parts.first[PART_ADDR];
+                    if (!addrObj) continue;
 
-                // content
-                auto* content = WalkerUtils::FindFirstChildById(cellWrapper, WalkerConfig::CELL_CONTENT_ID);
+                    int r = 0;
+                    int c = 0;
+                    Tree::GetCellAddr(addrObj, r, c);
 
-                // : cellWrapper child dump
-                WalkerDebug::DumpCellWrapperChildren(cellWrapper, r, c, depth);
+                    // ջ ּ (ڰ   ʰ)
+                    const bool stray = (r < 0 || c < 0 || r >= WalkerConfig::MAX_TABLE_ROWS || c >= WalkerConfig::MAX_TABLE_COLS);
+                    if (stray && WalkerConfig::TABLE_LOG)
+                        std::wcout << L"[TABLE] stray cell: bad addr r=" << r << L" c=" << c << L"\n";
 
-                // map 
-                CellPos pos{ r, c };
-                CellInfo info;
-                info.wrapper = cellWrapper;
-                info.content = content;
-                info.colSpan = colSpan;
-                info.rowSpan = rowSpan;
+                    // span
+                    int colSpan = 1;
+                    int rowSpan = 1;
+                    if (auto* spanObj = parts.first[PART_SPAN])
+                    {
+                        Tree::GetCellSpan(spanObj, colSpan, rowSpan);
+                        if (colSpan <= 0) colSpan = 1;
+                        if (rowSpan <= 0) rowSpan = 1;
+                    }
+
+                    // : cellWrapper child dump
+                    if (WalkerConfig::DUMP_MODE && WalkerConfig::DUMP_CELL_WRAPPER_CHILDREN)
+                        Tree::DumpCellWrapperChildren(cellWrapper, r, c, depth);
+
+                    CellInfo<Node> info;
+                    info.r = r;
+                    info.c = c;
+                    info.wrapper = cellWrapper;
+                    info.content = parts.first[PART_CONTENT];
+                    info.colSpan = colSpan;
+                    info.rowSpan = rowSpan;
 
-                cellMap[pos] = info;
+                    if (stray)
+                    {
+                        info.c = 0;
+                        info.colSpan = 1;
+                        info.rowSpan = 1;
+                        strayCells.push_back(info);
+                        continue;
+                    }
+                    cells.push_back(info);
 
-                inferredRowCount = std::max(inferredRowCount, r + rowSpan);
-                inferredColCount = std::max(inferredColCount, c + colSpan);
+                    maxStartRow = std::max(maxStartRow, r);
+                    colExtent = std::max(colExtent, c + 1);
+                }
             }
         }
 
-        if (cellMap.empty())
+        if (cells.empty() && strayCells.empty())
         {
-            Html::SetCellMode(prevCellMode);
-            return;
+            Html::SetCellMode(ctx, t.prevCellMode);
+            return false;
+        }
+
+        // colSpan       ڸ
+        //  ջ span ϳ    ĭ ä  (    )
+        colExtent = std::max(colExtent, 1);
+        for (auto& cell : cells)
+            cell.colSpan = std::min(cell.colSpan, colExtent - cell.c);
+
+        //  (row,col)      ̱ ( map  )
+        std::stable_sort(cells.begin(), cells.end(), [](const CellInfo<Node>& a, const CellInfo<Node>& b) {
+            return (a.r != b.r) ? (a.r < b.r) : (a.c < b.c);
+        });
+        {
+            size_t w = 0;
+            for (size_t i = 0; i < cells.size(); ++i)
+            {
+                if (i + 1 < cells.size() && cells[i + 1].r == cells[i].r && cells[i + 1].c == cells[i].c)
+                    continue;
+                cells[w++] = cells[i];
+            }
+            cells.resize(w);
         }
 
         // 3) rowCount / colCount Ȯ
-        const int rowCount = std::max((int)rowGroups.size(), inferredRowCount);
-        const int colCount = std::max(1, inferredColCount);
+        // - rowSpan   (tr  /    )  ڸ  ջ span    
+        // -   θ  (     ջ rowSpan    ڰ )
+        const int rowLimit = std::max(std::min(rowGroupCount, WalkerConfig::MAX_TABLE_ROWS), maxStartRow + 1);
+
+        int inferredRowCount = 0;
+        for (auto& cell : cells)
+        {
+            cell.rowSpan = std::min(cell.rowSpan, rowLimit - cell.r);
+            inferredRowCount = std::max(inferredRowCount, cell.r + cell.rowSpan);
+        }
+
+        //     (span )        ྿ (0)
+        //   rowSpan     (cells (r, c)  )
+        for (auto& cell : strayCells)
+        {
+            cell.r = inferredRowCount++;
+            cells.push_back(cell);
+        }
+
+        const int rowCount = std::max(rowGroupCount, inferredRowCount);
+        const int colCount = colExtent;
+        t.rowCount = rowCount;
+        t.colCount = colCount;
 
         if (WalkerConfig::TABLE_LOG)
         {
             std::wcout << L"\n[TABLE] ===== Render Start (GRID) =====\n";
             std::wcout << L"[TABLE] depth=" << depth
-                << L" rowGroups=" << (int)rowGroups.size()
+                << L" rowGroups=" << rowGroupCount
+                << L" cells=" << (int)cells.size()
                 << L" inferredRows=" << inferredRowCount
-                << L" inferredCols=" << inferredColCount
+                << L" colExtent=" << colExtent
                 << L" => rows=" << rowCount
                 << L" cols=" << colCount
                 << L"\n";
             std::wcout << L"[TABLE] ================================\n\n";
         }
 
-        // 4) occupancy grid (̺ Ʈ )
-        std::vector<std::vector<bool>> occupied(rowCount, std::vector<bool>(colCount, false));
+        // 4) occupancy: ึ   rowSpan     ( ü  )
+        t.covered.clear();
+        t.covered.resize((size_t)rowCount);
+
+        // 5) HTML   (/ NextCell)
+        if (Html::IsTextMode(ctx)) Html::BeginTextTable(ctx, out);
+        else out += "<table>\n";
 
-        // 5) HTML 
-        out += L"<table>\n";
+        t.r = 0;
+        t.c = 0;
+        t.ci = 0;
+        t.vi = 0;
+        t.rowOpen = false;
+        return true;
+    }
+
+    template <class NodeT>
+    NodeT* NextCellImpl(ConversionContext& ctx, std::string& out, TableCursor<NodeT>& t)
+    {
+        const std::vector<CellInfo<NodeT>>& cells = t.cells;
+        const bool text = Html::IsTextMode(ctx);
+
+        //  +   ǥ: ٱ   ħ (  ٱ   )
+        // -  ڸ  ٱ  ߰ ,  ڸ  ٱ  и
+        // -  带 ٲ Ƿ  ܵ ٱ  ó cellParagraphPolicy ̾
+        const bool flat = text && t.prevCellMode;
 
-        for (int r = 0; r < rowCount; ++r)
+        for (;;)
         {
-            out += L"<tr>\n";
+            if (t.r >= t.rowCount)
+            {
+                if (!text) out += "</table>\n";
+
+                // CellMode  (ģ ǥ ٲ  : ٱ     )
+                if (!flat) Html::SetCellMode(ctx, t.prevCellMode);
+                if (text) Html::EndTextTable(ctx, out);
+
+                // ǥ ü : ٱ    ƴ
+                if (t.prevCellMode) Html::MarkCellVisibleContent(ctx);
+                return nullptr;
+            }
 
-            for (int c = 0; c < colCount; ++c)
+            std::vector<CoveredSpan>& cov = t.covered[(size_t)t.r];
+
+            if (!t.rowOpen)
+            {
+                if (!text) out += "<tr>\n";
+                std::sort(cov.begin(), cov.end(), [](const CoveredSpan& a, const CoveredSpan& b) { return a.c0 < b.c0; });
+                t.vi = 0;
+                t.c = 0;
+                t.rowOpen = true;
+            }
+
+            if (t.c >= t.colCount)
+            {
+                //  ࿡ covered   
+                while (t.ci < cells.size() && cells[t.ci].r == t.r) ++t.ci;
+
+                std::vector<CoveredSpan>().swap(cov);
+                if (!text) out += "</tr>\n";
+                else if (!flat) out += ctx.html.textRowSeparator;
+                t.rowOpen = false;
+                ++t.r;
+                continue;
+            }
+
+            // covered ŵ ( ڸ ϴ  :  ڿ )
+            while (t.vi < cov.size() && cov[t.vi].c1 <= t.c) ++t.vi;
+            if (t.vi < cov.size() && cov[t.vi].c0 <= t.c)
             {
-                // covered ŵ
-                if (occupied[r][c])
+                // :   ڷ ڸ  (ึ  colCount-1)
+                const int c1 = std::min(cov[t.vi].c1, t.colCount);
+                if (text && !flat)
                 {
-                    continue;
+                    for (; t.c < c1; ++t.c)
+                        if (t.c > 0) out += ctx.html.textCellSeparator;
                 }
+                t.c = c1;
+                continue;
+            }
 
-                const CellPos pos{ r, c };
-                auto it = cellMap.find(pos);
+            while (t.ci < cells.size() && cells[t.ci].r == t.r && cells[t.ci].c < t.c) ++t.ci;
 
-                if (it != cellMap.end())
-                {
-                    const CellInfo& cell = it->second;
+            if (t.ci < cells.size() && cells[t.ci].r == t.r && cells[t.ci].c == t.c)
+            {
+                const CellInfo<NodeT>& cell = cells[t.ci++];
 
-                    // span attribute 
-                    std::wstring tdOpen = L"<td";
-                    if (cell.colSpan > 1)
-                    {
-                        tdOpen += L" colspan=\"";
-                        tdOpen += std::to_wstring(cell.colSpan);
-                        tdOpen += L"\"";
-                    }
-                    if (cell.rowSpan > 1)
-                    {
-                        tdOpen += L" rowspan=\"";
-                        tdOpen += std::to_wstring(cell.rowSpan);
-                        tdOpen += L"\"";
-                    }
+                // span  ŷ: Ʒ 鿡   ߰
+                for (int rr = t.r + 1; rr < t.r + cell.rowSpan && rr < t.rowCount; ++rr)
+                    t.covered[(size_t)rr].push_back({ t.c, t.c + cell.colSpan });
 
-                    // span  ŷ
-                    for (int rr = r; rr < r + cell.rowSpan && rr < rowCount; ++rr)
-                    {
-                        for (int cc = c; cc < c + cell.colSpan && cc < colCount; ++cc)
-                        {
-                            occupied[rr][cc] = true;
-                        }
-                    }
+                if (flat)
+                {
+                    t.spanTail = 0;
+                    t.c += cell.colSpan;
+                    return cell.content ? cell.content : cell.wrapper;
+                }
 
-                    //   (ӽ )
-                    std::wstring cellBuf;
-                    cellBuf.reserve(256);
+                if (text)
+                {
+                    if (t.c > 0) out += ctx.html.textCellSeparator;
 
-                    Html::SetCellMode(true);
+                    Html::SetCellMode(ctx, true);
+                    Html::BeginCellContent(ctx);
 
-                    if (cell.content)
-                        renderChild(cell.content, cellBuf, depth + 1);
-                    else if (cell.wrapper)
-                        renderChild(cell.wrapper, cellBuf, depth + 1);
+                    t.spanTail = cell.colSpan - 1;
+                    t.c += cell.colSpan;
+                    return cell.content ? cell.content : cell.wrapper;
+                }
 
-                    Html::SetCellMode(false);
+                // <td + span attribute (  out ٷ )
+                out += "<td";
+                if (cell.colSpan > 1)
+                {
+                    out += " colspan=\"";
+                    out += std::to_string(cell.colSpan);
+                    out += "\"";
+                }
+                if (cell.rowSpan > 1)
+                {
+                    out += " rowspan=\"";
+                    out += std::to_string(cell.rowSpan);
+                    out += "\"";
+                }
 
-                    const bool isEmpty = IsHtmlEffectivelyEmpty(cellBuf);
+                // data-hwpx-empty   ִ ڸ ( ̸ ڴ /<br/>̶ ª)
+                t.emptyAttrPos = out.size();
+                out += ">";
 
-                    if (WalkerConfig::TAG_EMPTY_TD && isEmpty)
-                    {
-                        tdOpen += L" data-hwpx-empty=\"1\"";
-                    }
+                Html::SetCellMode(ctx, true);
+                Html::BeginCellContent(ctx);
 
-                    tdOpen += L">";
-                    out += tdOpen;
+                t.c += cell.colSpan;
+                return cell.content ? cell.content : cell.wrapper;
+            }
 
-                    out += cellBuf;
+            // hole: wrapper  occupied ƴ ¥  ĭ ( covered/  )
+            int stop = t.colCount;
+            if (t.vi < cov.size()) stop = std::min(stop, cov[t.vi].c0);
+            if (t.ci < cells.size() && cells[t.ci].r == t.r) stop = std::min(stop, cells[t.ci].c);
 
-                    out += L"</td>\n";
+            for (; t.c < stop; ++t.c)
+            {
+                //  ڴ  ϰ  (   )
+                if (text)
+                {
+                    if (t.c > 0 && !flat) out += ctx.html.textCellSeparator;
                 }
-                else
+                else if (WalkerConfig::EMIT_EMPTY_TD_FOR_HOLES)
                 {
-                    // hole: wrapper  occupied ƴ ¥  ĭ
-                    if (WalkerConfig::EMIT_EMPTY_TD_FOR_HOLES)
-                    {
-                        if (WalkerConfig::TAG_EMPTY_TD)
-                            out += L"<td data-hwpx-empty=\"1\"></td>\n";
-                        else
-                            out += L"<td></td>\n";
-                    }
+                    if (WalkerConfig::TAG_EMPTY_TD)
+                        out += "<td data-hwpx-empty=\"1\"></td>\n";
+                    else
+                        out += "<td></td>\n";
                 }
             }
+        }
+    }
+
+    template <class NodeT>
+    void EndCellImpl(ConversionContext& ctx, std::string& out, TableCursor<NodeT>& t)
+    {
+        // 򹮿 ģ  ǥ : ٱ  ӵ
+        if (Html::IsTextMode(ctx) && t.prevCellMode) return;
+
+        const bool isEmpty = !Html::CellHasVisibleContent(ctx);
+
+        Html::SetCellMode(ctx, false);
+        if (Html::IsTextMode(ctx))
+        {
+            // colSpan    
+            for (; t.spanTail > 0; --t.spanTail) out += ctx.html.textCellSeparator;
+            return;
+        }
 
-            out += L"</tr>\n";
+        if (WalkerConfig::TAG_EMPTY_TD && isEmpty)
+        {
+            out.insert(t.emptyAttrPos, " data-hwpx-empty=\"1\"");
         }
 
-        out += L"</table>\n";
+        out += "</td>\n";
+    }
+}
+
+namespace TableRenderer
+{
+#if HWPX_USE_OWPML_SDK
+    bool BeginTable(ConversionContext& ctx, OWPML::CObject* tableRoot, std::string& out, int depth, TableCursor<OWPML::CObject>& t)
+    {
+        return BeginTableImpl<WalkerTree::SdkTree>(ctx, tableRoot, out, depth, t);
+    }
+
+    OWPML::CObject* NextCell(ConversionContext& ctx, std::string& out, TableCursor<OWPML::CObject>& t)
+    {
+        return NextCellImpl(ctx, out, t);
+    }
+
+    void EndCell(ConversionContext& ctx, std::string& out, TableCursor<OWPML::CObject>& t)
+    {
+        EndCellImpl(ctx, out, t);
+    }
+#endif
+
+    bool BeginTable(ConversionContext& ctx, const Native::Node* tableRoot, std::string& out, int depth, TableCursor<const Native::Node>& t)
+    {
+        return BeginTableImpl<WalkerTree::NativeTree>(ctx, tableRoot, out, depth, t);
+    }
+
+    const Native::Node* NextCell(ConversionContext& ctx, std::string& out, TableCursor<const Native::Node>& t)
+    {
+        return NextCellImpl(ctx, out, t);
+    }
 
-        // CellMode 
-        Html::SetCellMode(prevCellMode);
+    void EndCell(ConversionContext& ctx, std::string& out, TableCursor<const Native::Node>& t)
+    {
+        EndCellImpl(ctx, out, t);
     }
 }
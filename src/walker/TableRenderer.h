@@ -1,22 +1,73 @@
 #pragma once
 
+#include <cstddef>
 #include <string>
+#include <vector>
 
 namespace OWPML {
     class CObject;
 }
 
+namespace Native {
+    struct Node;
+}
+
+struct ConversionContext;
+
 namespace TableRenderer
 {
-    // DocumentWalker   Լ TableRenderer ٽ ȣؾ ؼ ݹ ޴´.
-    // (std::function   Լ ͷ )
-    using RenderChildFn = void(*)(OWPML::CObject* object, std::wstring& out, int depth);
-
-    // TABLE_ROOT_ID(805306373) ̺ HTML <table> 
-    void RenderTableFromRoot373(
-        OWPML::CObject* tableRoot,
-        std::wstring& out,
-        int depth,
-        RenderChildFn renderChild
-    );
+    template <class NodeT>
+    struct CellInfo
+    {
+        int r = 0;
+        int c = 0;
+        NodeT* wrapper = nullptr;
+        NodeT* content = nullptr;
+        int rowSpan = 1;
+        int colSpan = 1;
+    };
+
+    //   rowSpan    [c0, c1)
+    struct CoveredSpan
+    {
+        int c0 = 0;
+        int c1 = 0;
+    };
+
+    // TABLE_ROOT_ID(805306373) ǥ ϳ    ϴ Ŀ
+    // - BeginTable  (NextCell    ȸ  EndCell)*  NextCell nullptr̸ </table> 
+    // -   ȣ(DocumentWalker) ڱ  ÿ ȸ (ݹ  )
+    // - Ŀ ϸ  뷮 
+    // - (Html::IsTextMode)̸ ±   / ڷ ħ ( ĭ ڷ ڸ )
+    template <class NodeT>
+    struct TableCursor
+    {
+        std::vector<CellInfo<NodeT>> cells;             // (r, c) , ߺ 
+        std::vector<std::vector<CoveredSpan>> covered;  // ึ rowSpan  
+
+        int rowCount = 0;
+        int colCount = 0;
+        bool prevCellMode = false;
+
+        //  ġ
+        int r = 0;
+        int c = 0;
+        std::size_t ci = 0;     // cells Ŀ
+        std::size_t vi = 0;     // covered[r] Ŀ
+        bool rowOpen = false;
+        std::size_t emptyAttrPos = 0;   //  <td data-hwpx-empty ڸ
+        int spanTail = 0;               // :   colSpan     (EndCell )
+    };
+
+    // false: ׸   ( , Ŀ   )
+    bool BeginTable(ConversionContext& ctx, OWPML::CObject* tableRoot, std::string& out, int depth, TableCursor<OWPML::CObject>& t);
+
+    //   <td ...>   带  (̸ </table>  nullptr)
+    OWPML::CObject* NextCell(ConversionContext& ctx, std::string& out, TableCursor<OWPML::CObject>& t);
+    void EndCell(ConversionContext& ctx, std::string& out, TableCursor<OWPML::CObject>& t);
+
+    // Ƽ  Ʈ (ǥ  ID SDK )
+    bool BeginTable(ConversionContext& ctx, const Native::Node* tableRoot, std::string& out, int depth, TableCursor<const Native::Node>& t);
+    const Native::Node* NextCell(ConversionContext& ctx, std::string& out, TableCursor<const Native::Node>& t);
+    void EndCell(ConversionContext& ctx, std::string& out, TableCursor<const Native::Node>& t);
 }
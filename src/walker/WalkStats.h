@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstdint>
+
+// =========================================================
+// Ŀ  (ġ ȿ Ȯο, --stats)
+// - ȯ 1(ConversionContext) ,  ̸ Ŀ Ƽ ħ
+// =========================================================
+struct WalkStats
+{
+    std::uint64_t visitedNodes = 0;     // ڵ鷯  
+    std::uint64_t prunedSubtrees = 0;   // ġ ǳʶ Ʈ
+    std::uint64_t prunedNodes = 0;      //     (Ʈ , SDK Ʈ Ʈ )
+
+    void Add(const WalkStats& o)
+    {
+        visitedNodes += o.visitedNodes;
+        prunedSubtrees += o.prunedSubtrees;
+        prunedNodes += o.prunedNodes;
+    }
+};
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 
 namespace WalkerConfig
@@ -23,9 +24,16 @@ namespace WalkerConfig
     // =========================================================
     // Safety limits
     // =========================================================
-    inline constexpr int MAX_DEPTH = 5000;          // Ŀ  ġ
     inline constexpr int DUMP_MAX_REL_DEPTH = 20;   //     
 
+    // ǥ   (ջ cellAddr/cellSpan ,    )
+    // -   ּ    ڿ  ྿ ̰, colSpan     ڸ
+    inline constexpr int MAX_TABLE_ROWS = 1 << 20;
+    inline constexpr int MAX_TABLE_COLS = 1 << 12;
+
+    // Ʈ ȯ:  HTML(UTF-8)  Ʈ    
+    inline constexpr std::size_t STREAM_FLUSH_BYTES = 64 * 1024;
+
     // =========================================================
     // Table / Cell structure IDs ( α׷ "Ȯ" )
     // =========================================================
@@ -45,6 +53,7 @@ namespace WalkerConfig
     //   "¥ ĭ" 
     // - covered(  ) skip
     // - hole( ü  ) empty <td> ؾ ̾ƿ 
+    //   (   ڴ   ϰ  )
     inline constexpr bool EMIT_EMPTY_TD_FOR_HOLES = true;
 
     // hole  td ǥø  (LLM Ľ/뿡 )
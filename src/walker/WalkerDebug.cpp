@@ -5,6 +5,11 @@
 #include <iostream>
 #include <vector>
 
+#include "sdk/SdkConfig.h"
+
+// SDK Ʈ    (Ƽ Ʈ WalkerTree::NativeTree  no-op)
+#if HWPX_USE_OWPML_SDK
+
 #include "sdk/OwpmSDKPrelude.h"
 #include "sdk/SDK_Wrapper.h"
 
@@ -221,3 +226,5 @@ namespace WalkerDebug
     }
 
 } // namespace WalkerDebug
+
+#endif // HWPX_USE_OWPML_SDK
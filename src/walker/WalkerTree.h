@@ -0,0 +1,135 @@
+#pragma once
+
+// =========================================================
+// Ŀ ȸϴ Ʈ ߻ȭ ( Ÿ traits)
+// - SdkTree    : OWPML SDK ü Ʈ (Windows)
+// - NativeTree : src/native   淮 Ʈ (SDK )
+// DocumentWalker / TableRenderer ü ø ϳ  Ʈ  ó
+//  .cpp  include (SDK   )
+// =========================================================
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "sdk/SdkConfig.h"
+#include "sdk/SDK_Wrapper.h"
+#include "render/HtmlRenderer.h"
+#include "render/ConversionContext.h"
+#include "native/HwpxNode.h"
+#include "walker/WalkerConfig.h"
+
+#if HWPX_USE_OWPML_SDK
+#include "sdk/OwpmSDKPrelude.h"
+#include "walker/WalkerDebug.h"
+#endif
+
+namespace WalkerTree
+{
+#if HWPX_USE_OWPML_SDK
+    struct SdkTree
+    {
+        using Node = OWPML::CObject;
+
+        static constexpr unsigned int PARA_ID = ID_PARA_PType;
+        static constexpr unsigned int TEXT_ID = ID_PARA_T;
+        static constexpr unsigned int LINESEG_ID = ID_PARA_LineSeg;
+
+        // ġ ⺻  (  ̾ƿ , ElementHandlers::PruneOptions)
+        // - α׷ Ȯ  ̾ƿ ID (linesegarray/ü possz  SDK ID Ȯ  ߰)
+        // -   SDK   ǳʶٷ ĵ α(SCAN_MODE) ID --prune-id
+        static constexpr std::uint32_t PRUNE_IDS[] = {
+            WalkerConfig::CELL_ADDR_ID,
+            WalkerConfig::CELL_SPAN_ID,
+            WalkerConfig::CELL_SZ_ID,
+            WalkerConfig::CELL_MARGIN_ID,
+        };
+
+        static unsigned int GetID(Node* n) { return SDK::GetID(n); }
+
+        // SDK Ʈ ũ⸦  ( ᱹ  )  Ʈ
+        static std::uint64_t SubtreeSize(Node*) { return 1; }
+
+        // ڽ  ( nullptr)
+        static OWPML::Objectlist* Children(Node* n) { return n ? n->GetObjectList() : nullptr; }
+
+        static SDK::ListInfo GetListInfo(ConversionContext& ctx, Node* para) { return SDK::GetListInfoFromParagraph(ctx.head->index, (OWPML::CPType*)para); }
+        static void BeginParagraph(ConversionContext& ctx, Node* para) { Html::BeginParagraph(ctx, (OWPML::CPType*)para); }
+        static void ProcessText(ConversionContext& ctx, Node* text) { Html::ProcessText(ctx, (OWPML::CT*)text); }
+
+        static void GetCellAddr(Node* addrObj, int& r, int& c)
+        {
+            auto* addr = static_cast<OWPML::CCellAddr*>(addrObj);
+            r = (int)addr->GetRowAddr();
+            c = (int)addr->GetColAddr();
+        }
+
+        static void GetCellSpan(Node* spanObj, int& colSpan, int& rowSpan)
+        {
+            auto* span = static_cast<OWPML::CCellSpan*>(spanObj);
+            colSpan = (int)span->GetColSpan();
+            rowSpan = (int)span->GetRowSpan();
+        }
+
+        //  (WalkerConfig ۷ )
+        static void ScanLogOnce(int depth, Node* n) { WalkerDebug::ScanLogOnce(depth, n); }
+        static void DumpSubtree(Node* n, int absDepth, int relDepth) { WalkerDebug::DumpSubtree(n, absDepth, relDepth); }
+        static void DumpCellWrapperChildren(Node* n, int r, int c, int depth) { WalkerDebug::DumpCellWrapperChildren(n, r, c, depth); }
+    };
+#endif
+
+    struct NativeTree
+    {
+        using Node = const Native::Node;
+
+        static constexpr unsigned int PARA_ID = Native::NODE_PARA;
+        static constexpr unsigned int TEXT_ID = Native::NODE_TEXT;
+        static constexpr unsigned int LINESEG_ID = Native::NODE_LINESEG;
+
+        // ġ ⺻  (  ̾ƿ , ElementHandlers::PruneOptions)
+        static constexpr std::uint32_t PRUNE_IDS[] = {
+            Native::NODE_LINESEG_ARRAY,
+            Native::NODE_SEC_PR,
+            Native::NODE_SHAPE_LAYOUT,
+            WalkerConfig::CELL_ADDR_ID,
+            WalkerConfig::CELL_SPAN_ID,
+            WalkerConfig::CELL_SZ_ID,
+            WalkerConfig::CELL_MARGIN_ID,
+        };
+
+        static unsigned int GetID(Node* n) { return n ? n->id : 0; }
+
+        static std::uint64_t SubtreeSize(Node* n) { return n->subtreeSize; }
+
+        static const std::vector<Node*>* Children(Node* n) { return n ? &n->children : nullptr; }
+
+        static SDK::ListInfo GetListInfo(ConversionContext& ctx, Node* para) { return SDK::GetListInfoFromParaPr(ctx.head->index, para->paraPrIDRef); }
+        static void BeginParagraph(ConversionContext& ctx, Node* para) { Html::BeginParagraphWithStyle(ctx, para->styleIDRef); }
+
+        static void ProcessText(ConversionContext& ctx, Node* text)
+        {
+            for (Node* ch : text->children)
+            {
+                if (ch->id == Native::NODE_CHAR) Html::AppendTextUtf8(ctx, ch->text);
+                else if (ch->id == Native::NODE_LINEBREAK) Html::AppendLineBreak(ctx);
+            }
+        }
+
+        static void GetCellAddr(Node* addr, int& r, int& c)
+        {
+            r = (int)addr->rowAddr;
+            c = (int)addr->colAddr;
+        }
+
+        static void GetCellSpan(Node* span, int& colSpan, int& rowSpan)
+        {
+            colSpan = (int)span->colSpan;
+            rowSpan = (int)span->rowSpan;
+        }
+
+        // Ƽ Ʈ  
+        static void ScanLogOnce(int, Node*) {}
+        static void DumpSubtree(Node*, int, int) {}
+        static void DumpCellWrapperChildren(Node*, int, int, int) {}
+    };
+}
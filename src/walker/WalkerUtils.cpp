@@ -1,10 +1,55 @@
 #include "walker/WalkerUtils.h"
 
+#include "sdk/SdkConfig.h"
+#if HWPX_USE_OWPML_SDK
 #include "sdk/OwpmSDKPrelude.h"
+#endif
 #include "sdk/SDK_Wrapper.h"
+#include "native/HwpxNode.h"
+
+namespace
+{
+    // ids id slot ( -1)
+    static int FindSlot(const unsigned int* ids, int idCount, unsigned int id)
+    {
+        for (int i = 0; i < idCount; ++i)
+        {
+            if (ids[i] == id) return i;
+        }
+        return -1;
+    }
+
+    template <class NodeT>
+    static void AddToIndex(WalkerUtils::ChildIndex<NodeT>& index, const unsigned int* ids, int idCount, NodeT* ch, unsigned int id)
+    {
+        const int slot = FindSlot(ids, idCount, id);
+        if (slot < 0) return;
+
+        if (!index.first[slot]) index.first[slot] = ch;
+        index.count[slot]++;
+    }
+}
 
 namespace WalkerUtils
 {
+#if HWPX_USE_OWPML_SDK
+    ChildIndex<OWPML::CObject> IndexChildren(OWPML::CObject* parent, const unsigned int* ids, int idCount)
+    {
+        ChildIndex<OWPML::CObject> index;
+        if (!parent || !ids) return index;
+        if (idCount > ChildIndex<OWPML::CObject>::MAX_SLOTS) idCount = ChildIndex<OWPML::CObject>::MAX_SLOTS;
+
+        auto list = parent->GetObjectList();
+        if (!list) return index;
+
+        for (auto* ch : *list)
+        {
+            if (!ch) continue;
+            AddToIndex(index, ids, idCount, ch, SDK::GetID(ch));
+        }
+        return index;
+    }
+
     OWPML::CObject* FindFirstChildById(OWPML::CObject* parent, unsigned int targetId)
     {
         if (!parent) return nullptr;
@@ -76,4 +121,66 @@ namespace WalkerUtils
         }
         return cnt;
     }
+#endif
+
+    ChildIndex<const Native::Node> IndexChildren(const Native::Node* parent, const unsigned int* ids, int idCount)
+    {
+        ChildIndex<const Native::Node> index;
+        if (!parent || !ids) return index;
+        if (idCount > ChildIndex<const Native::Node>::MAX_SLOTS) idCount = ChildIndex<const Native::Node>::MAX_SLOTS;
+
+        for (const auto* ch : parent->children)
+        {
+            AddToIndex(index, ids, idCount, ch, ch->id);
+        }
+        return index;
+    }
+
+    const Native::Node* FindFirstChildById(const Native::Node* parent, unsigned int targetId)
+    {
+        if (!parent) return nullptr;
+
+        for (const auto* ch : parent->children)
+        {
+            if (ch->id == targetId)
+                return ch;
+        }
+        return nullptr;
+    }
+
+    const Native::Node* FindNthChildById(const Native::Node* parent, unsigned int targetId, int n)
+    {
+        if (!parent) return nullptr;
+        if (n < 0) return nullptr;
+
+        int hit = 0;
+        for (const auto* ch : parent->children)
+        {
+            if (ch->id != targetId) continue;
+
+            if (hit == n)
+                return ch;
+
+            hit++;
+        }
+
+        return nullptr;
+    }
+
+    void CollectChildrenById(const Native::Node* parent, unsigned int targetId, std::vector<const Native::Node*>& outVec)
+    {
+        outVec.clear();
+        if (!parent) return;
+
+        for (const auto* ch : parent->children)
+        {
+            if (ch->id == targetId)
+                outVec.push_back(ch);
+        }
+    }
+
+    int CountChildren(const Native::Node* parent)
+    {
+        return parent ? (int)parent->children.size() : 0;
+    }
 }
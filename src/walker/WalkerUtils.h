@@ -6,8 +6,30 @@ namespace OWPML {
     class CObject;
 }
 
+namespace Native {
+    struct Node;
+}
+
 namespace WalkerUtils
 {
+    // =========================================================
+    //   ȸ ڽ з (IndexChildren )
+    // - slot i = ȣڰ ѱ ids[i]
+    // -  ũ,  Ҵ  (ids MAX_SLOTS  ġ ID )
+    // =========================================================
+    template <class NodeT>
+    struct ChildIndex
+    {
+        static constexpr int MAX_SLOTS = 4;
+
+        NodeT* first[MAX_SLOTS] = {};   // slot ù ° child ( nullptr)
+        int count[MAX_SLOTS] = {};      // slot 
+    };
+
+    // parent  child   Ⱦ ids[i] ID  child slot i з
+    ChildIndex<OWPML::CObject> IndexChildren(OWPML::CObject* parent, const unsigned int* ids, int idCount);
+    ChildIndex<const Native::Node> IndexChildren(const Native::Node* parent, const unsigned int* ids, int idCount);
+
     // parent  child  targetId  ID  ù ° child ȯ ( nullptr)
     OWPML::CObject* FindFirstChildById(OWPML::CObject* parent, unsigned int targetId);
 
@@ -19,4 +41,10 @@ namespace WalkerUtils
 
     //  child  (Objectlist )
     int CountChildren(OWPML::CObject* parent);
+
+    // Ƽ  Ʈ (  )
+    const Native::Node* FindFirstChildById(const Native::Node* parent, unsigned int targetId);
+    const Native::Node* FindNthChildById(const Native::Node* parent, unsigned int targetId, int n);
+    void CollectChildrenById(const Native::Node* parent, unsigned int targetId, std::vector<const Native::Node*>& outVec);
+    int CountChildren(const Native::Node* parent);
 }